@@ -124,6 +124,11 @@ AUTORDFEXCEPTION(PropertyValueWithoutOrder)
  */
 AUTORDFEXCEPTION(InvalidPosition)
 
+/**
+ * Model was changed while a StatementCursor was reading it
+ */
+AUTORDFEXCEPTION(ModelChanged)
+
 }
 
 
@@ -4,9 +4,12 @@
 #include <memory>
 #include <map>
 #include <list>
+#include <mutex>
+#include <vector>
 
 #include <autordf/notification/DefaultNotifier.h>
 #include <autordf/StatementList.h>
+#include <autordf/StatementCursor.h>
 #include <autordf/NodeList.h>
 #ifdef USE_REDLAND
 #include <autordf/Storage.h>
@@ -22,6 +25,8 @@ class World;
 
 class ModelPrivate;
 
+class NamespaceIndex;
+
 class Parser;
 }
 class StatementList;
@@ -38,9 +43,18 @@ public:
      */
     AUTORDF_EXPORT Model();
 
+    /**
+     * Builds a new Model instance, using in-memory storage
+     * @param graphIndexes also index statements by graph, so that graph scoped finds and dropGraph()
+     * do not go through all statements. This doubles the number of indexes to maintain.
+     * Ignored by Redland, whose default storage always indexes graphs
+     */
+    AUTORDF_EXPORT explicit Model(bool graphIndexes);
+
 #ifdef USE_REDLAND
     /**
-     * Builds a new Model instance, using specified storage
+     * Builds a new Model instance, using specified storage.
+     * Storage must be created with contexts='yes' option for named graphs to be supported
      */
     AUTORDF_EXPORT Model(std::shared_ptr<Storage>);
 #endif
@@ -92,6 +106,29 @@ public:
      */
     AUTORDF_EXPORT void loadFromFile(FILE *fileHandle, const char *format, const std::string& baseIRI = "", const std::string& streamInfo = "<unknown stream>");
 
+    /**
+     * Loads rdf resource from a local file into a named graph, so that it can later be discarded with dropGraph()
+     * Statements that name their own graph, as in TriG or N-Quads, stay in their graph
+     * @param graph: the graph resource
+     * @param path: where to load data from
+     * @param baseIRI: prefix for prefix-less data
+     * @throw UnsupportedRdfFileFormat if format is not recognized
+     * @throw FileIOError is file does not exist
+     * @throw InternalError
+     */
+    AUTORDF_EXPORT void loadGraphFromFile(const Node& graph, const std::string& path, const std::string& baseIRI = "");
+
+    /**
+     * Loads rdf resource from a string into a named graph, see loadGraphFromFile()
+     * @param graph: the graph resource
+     * @param data: the memory buffer to read from
+     * @param format: fileformat to use. Name of a redland parser
+     * @param baseIRI: prefix for prefix-less data
+     * @throw UnsupportedRdfFileFormat if format is not recognized
+     * @throw InternalError
+     */
+    AUTORDF_EXPORT void loadGraphFromMemory(const Node& graph, const void* data, const char *format, const std::string& baseIRI = "");
+
     /**
      * Save model to file.
      * If no format is supplied, auto-detection is guessed
@@ -147,9 +184,17 @@ public:
      * Search for statements in model
      *
      * If no filter is given, gives back all elements from model
+     * If filter graph is set, only statements of that graph are searched
      */
     StatementList AUTORDF_EXPORT find(const Statement& filter = Statement()) const;
 
+    /**
+     * Search for statements in model, reading them one at a time instead of storing them all
+     *
+     * If no filter is given, goes through all elements from model
+     */
+    AUTORDF_EXPORT StatementCursor findCursor(const Statement& filter = Statement()) const;
+
     /**
      * Return the sources (subjects) of arc in an RDF graph given arc (predicate) and target (object).
      */
@@ -181,21 +226,82 @@ public:
     AUTORDF_EXPORT Node findTarget(const Node& source, const Node& arc) const;
 
     /**
-     * Adds a statement to model
+     * Adds a statement to model, in its graph if set, in the default graph otherwise
      * When this function returns, stmt is erased
      * @throw InternalError on issue
      */
     AUTORDF_EXPORT void add(Statement* stmt);
 
     /**
-     * Removes a statement from model
+     * Adds statements to model, as a single batch: addition notifications are aggregated
+     * @throw ReadOnlyError if model is read only
+     * @throw InternalError on issue
+     */
+    AUTORDF_EXPORT void add(const std::vector<Statement>& stmts);
+
+    /**
+     * Removes a statement from model. If its graph is not set, it is removed from the first graph holding it
      * When this function returns, stmt is erased
      * @throw InternalError on issue
      */
     AUTORDF_EXPORT void remove(Statement* stmt);
 
     /**
-     * Maps a XML namespace to its prefix
+     * Removes statements from model, as a single batch: removal notifications are aggregated
+     * Statements that are not in model are skipped
+     * @throw ReadOnlyError if model is read only
+     */
+    AUTORDF_EXPORT void remove(const std::vector<Statement>& stmts);
+
+    /**
+     * Removes all statements of a named graph, as a single batch: removal notifications are aggregated
+     * @return number of removed statements
+     * @throw ReadOnlyError if model is read only
+     * @throw InvalidNodeType if graph is not a resource
+     */
+    AUTORDF_EXPORT size_t dropGraph(const Node& graph);
+
+    /**
+     * Removes all statements from model, as a single batch: removal notifications are aggregated.
+     * Storage is dropped as a whole, statements are only gone through if notifier is not the default one.
+     * Namespace prefixes and base Uri are kept. Cursors opened before will throw ModelChanged
+     * @param preservedGraph if set, statements of this named graph are kept, for instance an ontology
+     * loaded with loadGraphFromFile() to reuse the model between jobs
+     * @return number of removed statements
+     * @throw ReadOnlyError if model is read only
+     * @throw InvalidNodeType if preservedGraph is a literal
+     */
+    AUTORDF_EXPORT size_t clear(const Node& preservedGraph = Node());
+
+    /**
+     * Removes all statements matching pattern, as a single batch: removal notifications are aggregated
+     * @param pattern statements to remove, all if empty
+     * @return number of removed statements
+     * @throw ReadOnlyError if model is read only
+     */
+    AUTORDF_EXPORT size_t clear(const Statement& pattern);
+
+    /**
+     * Copies the statements of other matching pattern to this model, without serializing them.
+     * Blank nodes are given new ids in this model. Namespace prefixes of other are added, unless
+     * this model already maps them to a namespace
+     * @param pattern statements to copy, all if empty
+     * @param blankNodeIds other blank node ids to this model ids. Pass the same map to several calls
+     * copying parts of the same graph so that they share their blank nodes
+     * @return number of copied statements
+     * @throw ReadOnlyError if model is read only
+     */
+    AUTORDF_EXPORT size_t copyFrom(const Model& other, const Statement& pattern = Statement(),
+                                   std::map<std::string, std::string> *blankNodeIds = nullptr);
+
+    /**
+     * Copies all statements of other to this model, see copyFrom().
+     * Also takes other base Uri if this model has none
+     */
+    AUTORDF_EXPORT void mergeFrom(const Model& other);
+
+    /**
+     * Maps a XML namespace to its prefix. If several prefixes are registered for it, returns the alphabetically first one
      * @throw std::out_of_range if not found
      */
     AUTORDF_EXPORT const std::string& nsToPrefix(const std::string& ns) const;
@@ -228,10 +334,24 @@ public:
     AUTORDF_EXPORT void addNamespacePrefix(const std::string& prefix, const std::string& ns);
 
     /**
-     * Returns the prefix that matches the given rdfiri if a prefix is registered, empty otherwise
+     * Returns the prefix of the longest registered namespace rdfiri starts with, empty if none
      */
     AUTORDF_EXPORT std::string iriPrefix(const std::string& rdfiri) const;
 
+    /**
+     * Finds the longest registered namespace iri starts with.
+     * Cost depends on iri length only, not on the number of registered namespaces
+     * @param prefix if not null and a namespace matches, set to the prefix of that namespace
+     * @return the length of the namespace, 0 if none matches
+     */
+    AUTORDF_EXPORT std::string::size_type longestNamespace(const std::string& iri, std::string *prefix = nullptr) const;
+
+    /**
+     * Mutex language bindings lock to serialize accesses to this model from several threads.
+     * Model does not lock it itself: as its storage and notifier, it is not thread safe
+     */
+    std::recursive_mutex& accessMutex() const { return _accessMutex; }
+
 protected:
     /**
      * A pointer to the librdf internal world structure
@@ -247,10 +367,14 @@ private:
     std::string _baseUri;
     // Prefixes seen during parsing prefix --> IRI
     std::map<std::string, std::string> _namespacesPrefixes;
+    // Reverse lookups in _namespacesPrefixes
+    std::shared_ptr<internal::NamespaceIndex> _namespaceIndex;
     // Emit notification for add() and remove() functions
     std::shared_ptr<notification::ANotifier> _notifier;
+    mutable std::recursive_mutex _accessMutex;
 
     friend class StatementList;
+    friend class StatementCursor;
     friend class NodeList;
 };
 
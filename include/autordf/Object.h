@@ -10,8 +10,11 @@
 #include <set>
 #include <functional>
 #include <optional>
+#include <string_view>
 
 #include <autordf/Factory.h>
+#include <autordf/Predicate.h>
+#include <autordf/PropertySnapshot.h>
 #include <autordf/PropertyValue.h>
 #include <autordf/I18StringVector.h>
 #include <autordf/Resource.h>
@@ -110,6 +113,11 @@ public:
      */
     AUTORDF_EXPORT Uri iri() const;
 
+    /**
+     * Same as iri(), without copying it. View is valid as long as this object is
+     */
+    std::string_view iriView() const { return _r.type() == NodeType::RESOURCE ? std::string_view(_r.name()) : std::string_view(); }
+
     /**
      * Return object Qualified Name, or empty if it is a blank node
      * If a prefix is defined for this iri in the underlying model, return a Qualified Name
@@ -135,6 +143,11 @@ public:
      */
     AUTORDF_EXPORT Object getObject(const Uri& propertyIRI) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT Object getObject(const Predicate& predicate) const;
+
     /**
      * Returns given property as Object.
      * If property is instanciated more than one, return one of the values, with no particular rule
@@ -142,6 +155,11 @@ public:
      */
     AUTORDF_EXPORT std::optional<Object> getOptionalObject(const Uri& propertyIRI) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT std::optional<Object> getOptionalObject(const Predicate& predicate) const;
+
     /**
      * Returns the list of object. If no object found returns empty vector
      * @param propertyIRI Internationalized Resource Identifiers property to get
@@ -150,6 +168,11 @@ public:
      */
     AUTORDF_EXPORT std::vector<Object> getObjectList(const Uri& propertyIRI, bool preserveOrdering) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT std::vector<Object> getObjectList(const Predicate& predicate, bool preserveOrdering) const;
+
     /**
      * Sets object to given property replacing existing value
      * @param propertyIRI Internationalized Resource Identifiers property to set value of
@@ -200,6 +223,11 @@ public:
      */
     AUTORDF_EXPORT PropertyValue getPropertyValue(const Uri& propertyIRI, Factory *f = nullptr) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT PropertyValue getPropertyValue(const Predicate& predicate, Factory *f = nullptr) const;
+
     /**
      * Returns given property as Object.
      * If property is instanciated more than one, return one of the values, with no particular rule
@@ -209,6 +237,11 @@ public:
      */
     AUTORDF_EXPORT std::optional<PropertyValue> getOptionalPropertyValue(const Uri& propertyIRI, Factory *f = nullptr) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT std::optional<PropertyValue> getOptionalPropertyValue(const Predicate& predicate, Factory *f = nullptr) const;
+
     /**
      * Returns the list of the values. If no value are found returns empty list
      * @param propertyIRI Internationalized Resource Identifiers property to query
@@ -217,6 +250,11 @@ public:
      */
     AUTORDF_EXPORT std::vector<PropertyValue> getPropertyValueList(const Uri& propertyIRI, bool preserveOrdering) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT std::vector<PropertyValue> getPropertyValueList(const Predicate& predicate, bool preserveOrdering) const;
+
     /**
      * Erases all previous values for property, and write unique value on place
      * @param propertyIRI Internationalized Resource Identifiers property to set
@@ -284,6 +322,22 @@ public:
 
     AUTORDF_EXPORT static bool isPropertyOrdered(const Uri& propertyIRI);
 
+    /**
+     * Returns the values of all the properties of this object, as nodes indexed by property IRI.
+     *
+     * Values of reified statements are included, but no ordering is preserved.
+     * Whole object is read in a single query, plus one query per reified statement, where
+     * calling getPropertyValueList() or getObjectList() for each property would issue one query per property
+     */
+    AUTORDF_EXPORT std::map<Uri, std::vector<Node>> getAllPropertyNodes() const;
+
+    /**
+     * Reads the values of all the properties of this object, to look them up without querying the model again.
+     *
+     * Whole object is read in a single query, plus one query per reified statement
+     */
+    AUTORDF_EXPORT PropertySnapshot snapshot() const;
+
     /**
      * Writes a data property in reified form.
      *
@@ -579,11 +633,40 @@ public:
         return objList;
     }
 
+    /**
+     * Offered to interfaces: one of the values of predicate in snapshot, as T
+     * @throw PropertyNotFound if predicate has no value in snapshot
+     */
+    template<typename T> static T snapshotObject(const PropertySnapshot& snapshot, const Predicate& predicate) {
+        return T(snapshot.value(predicate).asResource());
+    }
+
+    /**
+     * Offered to interfaces: one of the values of predicate in snapshot, as T, or nullptr if there is none
+     */
+    template<typename T> static std::shared_ptr<T> snapshotObjectOptional(const PropertySnapshot& snapshot, const Predicate& predicate) {
+        const Property *prop = snapshot.optionalValue(predicate);
+        return prop ? std::make_shared<T>(Object(prop->asResource())) : nullptr;
+    }
+
+    /**
+     * Offered to interfaces: values of predicate in snapshot, as T
+     * @throw CannotPreserveOrder if preserveOrdering is set and values were not written with ordering
+     */
+    template<typename T> static std::vector<T> snapshotObjectList(const PropertySnapshot& snapshot, const Predicate& predicate, bool preserveOrdering) {
+        std::vector<T> objList;
+        for ( const Property& prop : snapshot.values(predicate, preserveOrdering) ) {
+            objList.emplace_back(T(prop.asResource()));
+        }
+        return objList;
+    }
+
     /**
      * Offered to interfaces
+     * @param propertyIRI Uri, or Predicate not to build predicate node
      * @throw InvalidIRI if propertyIRI is empty
      */
-    template<typename T> std::vector<T> getObjectListImpl(const Uri& propertyIRI, bool preserveOrdering) const {
+    template<typename T, typename IRI> std::vector<T> getObjectListImpl(const IRI& propertyIRI, bool preserveOrdering) const {
         std::vector<T> objList;
         propertyIterate(propertyIRI, preserveOrdering, [&objList](const Property& prop) {
             objList.emplace_back(T(prop.asResource()));
@@ -621,9 +704,10 @@ public:
 
     /**
      * Offered to interfaces
+     * @param propertyIRI Uri, or Predicate not to build predicate node
      * @throw InvalidIRI if propertyIRI is empty
      */
-    template<cvt::RdfTypeEnum rdftype, typename T> std::vector<T> getValueListImpl(const Uri& propertyIRI, bool preserveOrdering) const {
+    template<cvt::RdfTypeEnum rdftype, typename T, typename IRI> std::vector<T> getValueListImpl(const IRI& propertyIRI, bool preserveOrdering) const {
         std::vector<T> valuesList;
         propertyIterate(propertyIRI, preserveOrdering, [&valuesList](const Property& prop) {
             valuesList.emplace_back(prop.value().get<rdftype, T>());
@@ -710,6 +794,18 @@ private:
      */
     AUTORDF_EXPORT void propertyIterate(const Uri& propertyIRI, bool preserveOrdering, std::function<void (const Property& prop)> cb) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT void propertyIterate(const Predicate& predicate, bool preserveOrdering, std::function<void (const Property& prop)> cb) const;
+
+    /**
+     * Implementation of the Uri and Predicate flavours of getters
+     */
+    template<typename IRI> std::optional<Object> getOptionalObjectImpl(const IRI& propertyIRI) const;
+    template<typename IRI> std::optional<PropertyValue> getOptionalPropertyValueImpl(const IRI& propertyIRI, Factory *f) const;
+    template<typename IRI> void propertyIterateImpl(const IRI& propertyIRI, bool preserveOrdering, const std::function<void (const Property& prop)>& cb) const;
+
     /**
      * Creates a new resource that stores a value for this resource
      */
@@ -844,6 +940,14 @@ private:
      */
     Object cloneRecursiveStopAtResourcesInternal(const Uri& newIri, bool(*doNotClone)(const Object &currentObject, const std::string &sourcePredicateIri, const Object *parentObject), bool first = false) const;
 
+    /**
+     * Copies the graph of this object to another object, for cloneRecursiveStopAtResources.
+     * The blank nodes to clone are found in a single traversal, then all statements of the copy are added at once
+     * @param doNotClone see wrapper cloneRecursiveStopAtResources
+     * @param to object to copy the properties and reified properties to
+     */
+    void cloneGraph(bool(*doNotClone)(const Object &currentObject, const std::string &sourcePredicateIri, const Object *parentObject), Object& to) const;
+
     /**
      * Recompute list order to remove missing value after deletion 
      */
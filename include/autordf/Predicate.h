@@ -0,0 +1,53 @@
+#ifndef AUTORDF_PREDICATE_H
+#define AUTORDF_PREDICATE_H
+
+#include <memory>
+#include <string>
+
+#include <autordf/Node.h>
+#include <autordf/Uri.h>
+#include <autordf/autordf_export.h>
+
+namespace autordf {
+
+namespace internal {
+class World;
+}
+
+/**
+ * A property IRI, along with the node built once for it.
+ *
+ * Object and Resource getters taking a Predicate instead of an Uri do not build a node from the IRI
+ * at each call. Being an Uri, a Predicate can be given to any other function.
+ * Meant to be built once per property, typically as a function local static:
+ * @code
+ * static const autordf::Predicate NAME("http://xmlns.com/foaf/0.1/name");
+ * object.getPropertyValue(NAME);
+ * @endcode
+ */
+class Predicate : public Uri {
+public:
+    /**
+     * @throw InvalidIRI if iri is empty
+     */
+    AUTORDF_EXPORT explicit Predicate(const std::string& iri);
+
+    /**
+     * Node for this IRI
+     */
+    const Node& node() const { return _node; }
+
+private:
+    // Keeps the world the node belongs to alive, even after last model is destroyed
+    std::shared_ptr<internal::World> _world;
+    Node _node;
+    // Shared with the properties read using this predicate
+    std::shared_ptr<const std::string> _sharedIri;
+
+    friend class PropertySnapshot;
+    friend class Resource;
+};
+
+}
+
+#endif //AUTORDF_PREDICATE_H
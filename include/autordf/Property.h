@@ -1,6 +1,7 @@
 #ifndef AUTORDF_PROPERTY_H
 #define AUTORDF_PROPERTY_H
 
+#include <memory>
 #include <string>
 
 #include <autordf/NodeType.h>
@@ -23,7 +24,7 @@ public:
     /**
      * Creates a new property of emtpy type
      */
-    Property() { setType(NodeType::EMPTY); }
+    Property() : _iri(emptyIri()), _factory(nullptr) { setType(NodeType::EMPTY); }
 
     /**
      * Return node type for this property
@@ -43,7 +44,7 @@ public:
     /**
      * Returns property IRI
      */
-    const std::string& iri() const { return _iri; }
+    const std::string& iri() const { return *_iri; }
 
     /**
      * Returns property value
@@ -68,17 +69,27 @@ public:
 
 private:
     NodeType _type;
-    std::string _iri;
+    // Shared by all the properties read at once for a predicate, so that they do not each hold a copy of it
+    std::shared_ptr<const std::string> _iri;
     PropertyValue _value;
 
     Factory *_factory;
 
-    // Should only be built through Factory
-    Property(NodeType t, const std::string& iri, Factory *f) : _iri(iri), _factory(f) { setType(t); }
+    // Should only be built through Factory or Resource
+    Property(NodeType t, const std::string& iri, Factory *f) : _iri(std::make_shared<const std::string>(iri)), _factory(f) { setType(t); }
+
+    Property(NodeType t, const std::shared_ptr<const std::string>& iri, Factory *f) : _iri(iri), _factory(f) { setType(t); }
 
     void setType(NodeType t);
 
+    /**
+     * Returns the IRI shared by all empty properties
+     */
+    AUTORDF_EXPORT static const std::shared_ptr<const std::string>& emptyIri();
+
     friend class Factory;
+    friend class Predicate;
+    friend class Resource;
 };
 
 std::ostream& operator<<(std::ostream& os, const Property&);
@@ -0,0 +1,96 @@
+#ifndef AUTORDF_PROPERTYSNAPSHOT_H
+#define AUTORDF_PROPERTYSNAPSHOT_H
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <autordf/Predicate.h>
+#include <autordf/Property.h>
+#include <autordf/autordf_export.h>
+
+namespace autordf {
+
+class Object;
+
+/**
+ * Values of all the properties of an object, read at once by Object::snapshot().
+ *
+ * Looking a property up does not query the model anymore: this is meant for reading many
+ * properties of the same object, as generated classes load() method do.
+ * Values are not updated when model changes.
+ */
+class PropertySnapshot {
+public:
+    /**
+     * Values of given property, as Object::getPropertyValueList() or Object::getObjectList() would return them.
+     * Empty if property has no value
+     * @param preserveOrdering if true, values are returned in the order they were written in
+     * @throw CannotPreserveOrder if preserveOrdering is set and values were not written with ordering
+     */
+    AUTORDF_EXPORT const std::vector<Property>& values(const Predicate& predicate, bool preserveOrdering) const;
+
+    /**
+     * One of the values of given property, with no particular rule, or nullptr if property has no value
+     */
+    AUTORDF_EXPORT const Property* optionalValue(const Predicate& predicate) const;
+
+    /**
+     * One of the values of given property, with no particular rule
+     * @throw PropertyNotFound if property has no value
+     */
+    AUTORDF_EXPORT const Property& value(const Predicate& predicate) const;
+
+    /**
+     * Values of given property, as Object::getPropertyValueList() would return them
+     * @throw CannotPreserveOrder if preserveOrdering is set and values were not written with ordering
+     */
+    AUTORDF_EXPORT std::vector<PropertyValue> valueList(const Predicate& predicate, bool preserveOrdering) const;
+
+    /**
+     * Values of given property, converted to T
+     * @throw CannotPreserveOrder if preserveOrdering is set and values were not written with ordering
+     * @throw DataConvertionFailure
+     */
+    template<cvt::RdfTypeEnum rdftype, typename T> std::vector<T> valueList(const Predicate& predicate, bool preserveOrdering) const {
+        std::vector<T> valuesList;
+        for ( const Property& prop : values(predicate, preserveOrdering) ) {
+            valuesList.emplace_back(prop.value().get<rdftype, T>());
+        }
+        return valuesList;
+    }
+
+private:
+    struct Values {
+        // Unreified values first, then reified ones, sorted by order
+        std::vector<Property> properties;
+        size_t unreifiedCount = 0;
+        // Reified values along with their order, until snapshot is complete
+        std::vector<std::pair<std::optional<long long>, Property>> reified;
+        bool missingOrder = false;
+    };
+
+    // Subject name, for error messages
+    std::string _subject;
+    // Indexed by IRI, viewed in the IRI string the properties share
+    std::unordered_map<std::string_view, Values> _values;
+
+    explicit PropertySnapshot(const std::string& subject) : _subject(subject) {}
+
+    void addUnreified(Property&& prop);
+
+    void addReified(Property&& prop, std::optional<long long> order);
+
+    /**
+     * Sorts reified values by order, once all values are added
+     */
+    void complete();
+
+    friend class Object;
+};
+
+}
+
+#endif //AUTORDF_PROPERTYSNAPSHOT_H
@@ -1,7 +1,14 @@
 #ifndef AUTORDF_PROPERTYVALUE_H
 #define AUTORDF_PROPERTYVALUE_H
 
+#include <atomic>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 #include <autordf/cvt/Cvt.h>
 
@@ -13,6 +20,12 @@ class I18String;
 
 /**
  * Stores a Value (aka Literal) of a Web Semantic Resource
+ *
+ * The value decoded by the first get() is kept, so that reading the value again with the same types does not parse
+ * the literal again. Concurrent get() calls on the same value are thread safe.
+ * The decoded value is dropped by all the std::string members that can change the lexical form, which are shadowed
+ * here. Lexical form must not be modified through a std::string reference to the value, or through a reference or
+ * iterator obtained before a get() call, as the decoded value would not be updated.
  */
 class PropertyValue : public std::string {
 public:
@@ -35,8 +48,8 @@ public:
      * @param lang optional xml:lang for this literal property
      * @param dataTypeIri optional literal data type
      */
-    PropertyValue(const std::string& rawValue, const std::string& lang = "", const std::string& dataTypeIri = "")
-            : std::string(rawValue), _lang(lang), _dataTypeIri(dataTypeIri) {}
+    PropertyValue(std::string rawValue, const std::string& lang = "", const std::string& dataTypeIri = "")
+            : std::string(std::move(rawValue)), _lang(shareLang(lang)), _dataType(shareDataType(dataTypeIri)) {}
 
     /**
      * Builds from a string literal
@@ -45,8 +58,9 @@ public:
      * @param lang optional xml:lang for this literal property
      * @param dataTypeIri optional literal data type
      */
-    PropertyValue(const std::string& rawValue, const char* lang, const char* dataTypeIri)
-            : std::string(rawValue), _lang(lang ? lang : ""), _dataTypeIri(dataTypeIri ? dataTypeIri : "") {}
+    PropertyValue(std::string rawValue, const char* lang, const char* dataTypeIri)
+            : std::string(std::move(rawValue)), _lang(shareLang(lang ? lang : "")),
+              _dataType(shareDataType(dataTypeIri ? dataTypeIri : "")) {}
 
     /**
     * Builds from an internationalized string
@@ -55,12 +69,54 @@ public:
     */
     PropertyValue(const autordf::I18String& value);
 
+    /**
+     * Copies value, along with its decoded value
+     */
+    PropertyValue(const PropertyValue& other) : std::string(other), _lang(other._lang), _dataType(other._dataType) {
+        copyDecoded(other);
+    }
+
+    /**
+     * Moves value, along with its decoded value
+     */
+    PropertyValue(PropertyValue&& other) noexcept
+            : std::string(std::move(other)), _lang(std::move(other._lang)), _dataType(std::move(other._dataType)) {
+        copyDecoded(other);
+    }
+
+    /**
+     * Copies value, along with its decoded value
+     */
+    PropertyValue& operator=(const PropertyValue& other) {
+        std::string::operator=(other);
+        _lang = other._lang;
+        _dataType = other._dataType;
+        copyDecoded(other);
+        return *this;
+    }
+
+    /**
+     * Moves value, along with its decoded value
+     */
+    PropertyValue& operator=(PropertyValue&& other) noexcept {
+        std::string::operator=(std::move(other));
+        _lang = std::move(other._lang);
+        _dataType = std::move(other._dataType);
+        copyDecoded(other);
+        return *this;
+    }
+
     /**
      * @return the literal data type if it is set, blank string otherwise
      * Does makes sense only in case this property holds a literal
      */
     AUTORDF_EXPORT const std::string& dataTypeIri() const;
 
+    /**
+     * @return the literal data type if it is set and is one the types known to AutoRDF
+     */
+    AUTORDF_EXPORT std::optional<cvt::RdfTypeEnum> rdfType() const;
+
     /**
      * @return the literal lang if it is set, blank string otherwise
      * Does makes sense only in case this property holds a literal
@@ -90,6 +146,7 @@ public:
      * @throw DataConvertionFailure
      */
     template<cvt::RdfTypeEnum rdfType, typename T> PropertyValue& set(const T& val) {
+        // val is not kept as decoded value: the literal may not hold it exactly (e.g. rounded doubles)
         assign(cvt::toRdf<T, rdfType>::val(val));
         return *this;
     };
@@ -99,9 +156,139 @@ public:
      * @throw DataConvertionFailure
      */
     template<cvt::RdfTypeEnum rdfType, typename T> T get() const {
-        return cvt::toCpp<T, rdfType>::val(*this);
+        if constexpr (IsDecodable<T, Decoded>::value) {
+            // Once ready, the decoded value is not written anymore until the value changes
+            if (_decodedState.load(std::memory_order_acquire) == DecodedState::READY && _decodedType == rdfType) {
+                if (const T *decoded = std::get_if<T>(&_decoded)) {
+                    return *decoded;
+                }
+            }
+            T val = cvt::toCpp<T, rdfType>::val(*this);
+            DecodedState expected = DecodedState::EMPTY;
+            if (_decodedState.compare_exchange_strong(expected, DecodedState::WRITING, std::memory_order_acquire)) {
+                _decoded = val;
+                _decodedType = rdfType;
+                _decodedState.store(DecodedState::READY, std::memory_order_release);
+            }
+            return val;
+        } else {
+            return cvt::toCpp<T, rdfType>::val(*this);
+        }
     };
 
+    /**
+     * Replaces the lexical form, as std::string::assign() does
+     */
+    template<typename... Args> PropertyValue& assign(Args&&... args) {
+        dropDecoded();
+        std::string::assign(std::forward<Args>(args)...);
+        return *this;
+    }
+
+    /**
+     * Appends to the lexical form, as std::string::operator+=() does
+     */
+    template<typename Arg> PropertyValue& operator+=(Arg&& arg) {
+        dropDecoded();
+        std::string::operator+=(std::forward<Arg>(arg));
+        return *this;
+    }
+
+    /**
+     * Appends to the lexical form, as std::string::append() does
+     */
+    template<typename... Args> PropertyValue& append(Args&&... args) {
+        dropDecoded();
+        std::string::append(std::forward<Args>(args)...);
+        return *this;
+    }
+
+    /**
+     * Inserts into the lexical form, as std::string::insert() does
+     */
+    template<typename... Args> decltype(auto) insert(Args&&... args) {
+        dropDecoded();
+        return std::string::insert(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Erases from the lexical form, as std::string::erase() does
+     */
+    template<typename... Args> decltype(auto) erase(Args&&... args) {
+        dropDecoded();
+        return std::string::erase(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Replaces part of the lexical form, as std::string::replace() does
+     */
+    template<typename... Args> decltype(auto) replace(Args&&... args) {
+        dropDecoded();
+        return std::string::replace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Resizes the lexical form, as std::string::resize() does
+     */
+    template<typename... Args> void resize(Args&&... args) {
+        dropDecoded();
+        std::string::resize(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Appends a character to the lexical form
+     */
+    void push_back(char c) {
+        dropDecoded();
+        std::string::push_back(c);
+    }
+
+    /**
+     * Removes the last character of the lexical form
+     */
+    void pop_back() {
+        dropDecoded();
+        std::string::pop_back();
+    }
+
+    /**
+     * Empties the lexical form
+     */
+    void clear() {
+        dropDecoded();
+        std::string::clear();
+    }
+
+    /**
+     * Swaps lexical forms, as std::string::swap() does
+     */
+    void swap(std::string& other) {
+        dropDecoded();
+        std::string::swap(other);
+    }
+
+    /**
+     * Access to characters of the lexical form. Non const accessors drop the decoded value, as they allow changing it
+     */
+    char& operator[](size_type pos) { dropDecoded(); return std::string::operator[](pos); }
+    const char& operator[](size_type pos) const { return std::string::operator[](pos); }
+    char& at(size_type pos) { dropDecoded(); return std::string::at(pos); }
+    const char& at(size_type pos) const { return std::string::at(pos); }
+    char& front() { dropDecoded(); return std::string::front(); }
+    const char& front() const { return std::string::front(); }
+    char& back() { dropDecoded(); return std::string::back(); }
+    const char& back() const { return std::string::back(); }
+    char* data() { dropDecoded(); return std::string::data(); }
+    const char* data() const { return std::string::data(); }
+    iterator begin() { dropDecoded(); return std::string::begin(); }
+    const_iterator begin() const { return std::string::begin(); }
+    iterator end() { dropDecoded(); return std::string::end(); }
+    const_iterator end() const { return std::string::end(); }
+    reverse_iterator rbegin() { dropDecoded(); return std::string::rbegin(); }
+    const_reverse_iterator rbegin() const { return std::string::rbegin(); }
+    reverse_iterator rend() { dropDecoded(); return std::string::rend(); }
+    const_reverse_iterator rend() const { return std::string::rend(); }
+
     /**
      * Comparison operator
      */
@@ -113,14 +300,69 @@ public:
     bool operator!=(const char* s) const;
 
 private:
-    std::string _lang;
-    std::string _dataTypeIri;
+    /**
+     * Data type: IRI, and matching enum when known.
+     * Known data types are built once for the whole process, other ones are shared by the copies of a value
+     */
+    using DataType = std::pair<const std::string, std::optional<cvt::RdfTypeEnum>>;
+
+    /**
+     * C++ types get() keeps the decoded value for
+     */
+    using Decoded = std::variant<bool, char, unsigned char, short, unsigned short, long, unsigned long,
+                                 long long, unsigned long long, float, double, boost::posix_time::ptime>;
+
+    template<typename T, typename Variant> struct IsDecodable;
+    template<typename T, typename... Types> struct IsDecodable<T, std::variant<Types...>>
+            : std::disjunction<std::is_same<T, Types>...> {};
+
+    /** nullptr when no lang is set */
+    std::shared_ptr<const std::string> _lang;
+    /** nullptr when no data type is set */
+    std::shared_ptr<const DataType> _dataType;
+    enum class DecodedState : unsigned char { EMPTY, WRITING, READY };
+
+    /** Value decoded by first get(), meaningful only when READY. Initialized in full for compilers to know it is */
+    mutable Decoded _decoded{0LL};
+    /** Type the value was decoded from, meaningful only when READY */
+    mutable cvt::RdfTypeEnum _decodedType = cvt::RdfTypeEnum::xsd_string;
+    /** Written once by the get() call moving it from EMPTY to WRITING, then read by all when READY */
+    mutable std::atomic<DecodedState> _decodedState{DecodedState::EMPTY};
+
+    /**
+     * Forgets decoded value. Not thread safe, as any change to the value
+     */
+    void dropDecoded() {
+        _decodedState.store(DecodedState::EMPTY, std::memory_order_relaxed);
+    }
+
+    /**
+     * Takes the decoded value of other, if it has one
+     */
+    void copyDecoded(const PropertyValue& other) {
+        if (other._decodedState.load(std::memory_order_acquire) == DecodedState::READY) {
+            _decoded = other._decoded;
+            _decodedType = other._decodedType;
+            _decodedState.store(DecodedState::READY, std::memory_order_relaxed);
+        } else {
+            dropDecoded();
+        }
+    }
+
+    /**
+     * Returns the data type, nullptr for an empty IRI. Known data types are not allocated again. Thread safe
+     */
+    AUTORDF_EXPORT static std::shared_ptr<const DataType> shareDataType(std::string_view dataTypeIri);
+
+    /**
+     * Returns the lang, nullptr for an empty lang
+     */
+    AUTORDF_EXPORT static std::shared_ptr<const std::string> shareLang(std::string_view lang);
 
     /**
-     * Gets the data type of the Property Value
-     * @return
+     * Gets the data type IRI of the Property Value, xsd:string or rdf:langString when none is set
      */
-    std::string explicitDataType() const;
+    const std::string& explicitDataTypeIri() const;
 };
 
 /**
@@ -128,7 +370,7 @@ private:
  */
 template<> inline PropertyValue& PropertyValue::set<cvt::RdfTypeEnum::rdf_langString, I18String>(const I18String& val) {
     assign(cvt::toRdf<autordf::I18String, cvt::RdfTypeEnum::rdf_langString>::val(val));
-    _lang = val.lang();
+    _lang = shareLang(val.lang());
     return *this;
 }
 
@@ -5,7 +5,9 @@
 #include <list>
 #include <iosfwd>
 #include <optional>
+#include <vector>
 
+#include <autordf/Predicate.h>
 #include <autordf/Property.h>
 #include <autordf/Uri.h>
 
@@ -58,6 +60,11 @@ public:
      */
     AUTORDF_EXPORT std::optional<Property> getOptionalProperty(const Uri& iri, Factory *f = nullptr) const;
 
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT std::optional<Property> getOptionalProperty(const Predicate& predicate, Factory *f = nullptr) const;
+
     /**
      * Lists all values for property matching iri name
      * If iri is empty, matches ALL properties with ALL their values
@@ -69,6 +76,22 @@ public:
      */
     AUTORDF_EXPORT std::shared_ptr<std::list<Property>> getPropertyValues() const;
 
+    /**
+     * Appends all values for property matching iri name to values.
+     * Unlike the list returning version, values can be reused from a call to another to save allocations
+     */
+    AUTORDF_EXPORT void getPropertyValues(const Uri& iri, std::vector<Property> *values) const;
+
+    /**
+     * Same as above, without building predicate node
+     */
+    AUTORDF_EXPORT void getPropertyValues(const Predicate& predicate, std::vector<Property> *values) const;
+
+    /**
+     * Appends all values for all properties to values
+     */
+    AUTORDF_EXPORT void getPropertyValues(std::vector<Property> *values) const;
+
     /**
      * Adds a property to the resource. Property should not be empty
      * @returns a reference to current object
@@ -122,6 +145,14 @@ private:
 
     static void propertyAsNode(const Property& p, Node *n);
 
+    void appendProperty(const std::shared_ptr<const std::string>& iri, const Node& object, std::vector<Property> *values) const;
+
+    Node subjectNode() const;
+
+    std::optional<Property> getOptionalProperty(const Node& predicate, const std::shared_ptr<const std::string>& iri, Factory *f) const;
+
+    void getPropertyValues(const Node& predicate, const std::shared_ptr<const std::string>& iri, std::vector<Property> *values) const;
+
     friend class Factory;
     friend std::ostream& operator<<(std::ostream& os, const Resource&);
 };
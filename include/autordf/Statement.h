@@ -11,6 +11,8 @@ namespace autordf {
  * A Statement is uses both:
  *  - As a container of data retrieved from the model
  *  - As a query language to find statement in the model: subject, predicate, object can be empty or partially filled
+ *
+ * A statement belongs to the default graph, or to a named graph when graph is set
  */
 class Statement {
 public:
@@ -24,6 +26,11 @@ public:
      */
     Statement(Node s, Node p, Node o) : subject(s), predicate(p), object(o) {}
 
+    /**
+     * Construct from individual nodes, in a named graph
+     */
+    Statement(Node s, Node p, Node o, Node g) : subject(s), predicate(p), object(o), graph(g) {}
+
     /**
      * Statement subject
      *
@@ -44,6 +51,14 @@ public:
      * Can be empty (empty value or EMPTY type) when used as a model query
      */
     Node object;
+
+    /**
+     * Statement graph (context), a resource
+     *
+     * Empty for the default graph when adding a statement. When used as a model query or to remove a statement,
+     * empty matches any graph
+     */
+    Node graph;
 };
 
 /**
@@ -53,6 +68,7 @@ public:
  * S: {Subject}
  * P: {Predicate}
  * O: {Object}
+ * G: {Graph}, only if set
  */
 std::ostream& operator<<(std::ostream& os, const Statement&);
 }
@@ -0,0 +1,57 @@
+#ifndef AUTORDF_STATEMENTCURSOR_H
+#define AUTORDF_STATEMENTCURSOR_H
+
+#include <memory>
+
+#include <autordf/Statement.h>
+#include <autordf/autordf_export.h>
+
+namespace autordf {
+
+class Model;
+
+namespace internal {
+class ModelPrivate;
+class Stream;
+}
+
+/**
+ * Reads the statements matching a query one at a time, in constant memory, where StatementList may store them all.
+ * Obtained through Model::findCursor().
+ *
+ * The cursor keeps the underlying model storage alive. Changing the model while reading makes next() throw ModelChanged
+ *
+ * Typical usage:
+ * @code
+ * StatementCursor cursor = model.findCursor(query);
+ * Statement stmt;
+ * while ( cursor.next(&stmt) ) {
+ *     ...
+ * }
+ * @endcode
+ */
+class StatementCursor {
+public:
+    /**
+     * Reads next statement
+     * @param stmt set to the next statement if there is one
+     * @return false if there is no more statement
+     * @throw ModelChanged if model was changed since the cursor was created
+     */
+    AUTORDF_EXPORT bool next(Statement* stmt);
+
+private:
+    std::shared_ptr<internal::ModelPrivate> _model;
+    std::shared_ptr<internal::Stream> _stream;
+    unsigned long _revision;
+    bool _started = false;
+    bool _done = false;
+
+    StatementCursor(const Statement& query, const Model *m);
+
+    friend class Model;
+};
+
+}
+
+#endif //AUTORDF_STATEMENTCURSOR_H
@@ -18,7 +18,7 @@ class World;
 class Storage {
 public:
     /**
-     * Create a in-memory hash storage.
+     * Create a in-memory hash storage, with contexts so that statements can be stored in named graphs
      **/
     AUTORDF_EXPORT Storage();
 
@@ -2,11 +2,18 @@
 #define AUTORDF_CVT_CVT_H
 
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 #include <boost/date_time.hpp>
 
+#include <autordf/cvt/DateTime.h>
 #include <autordf/cvt/RdfTypeEnum.h>
 #include <autordf/Exception.h>
 #include <autordf/I18String.h>
@@ -16,23 +23,36 @@ namespace cvt {
 
 // @cond internal
 
-inline std::string trim(const std::string &s)
-{
-    std::string::const_iterator it = s.begin();
-    while (it != s.end() && isspace(*it))
-        it++;
-
-    std::string::const_reverse_iterator rit = s.rbegin();
-    while (rit.base() != it && isspace(*rit))
-        rit++;
+/**
+ * Returns value without leading and trailing white spaces, as the XSD whiteSpace collapse facet does, without copying it
+ */
+inline std::string_view trimmed(const std::string& s) {
+    const char *first = s.data();
+    const char *last = first + s.size();
+    while (first != last && isspace(static_cast<unsigned char>(*first))) {
+        ++first;
+    }
+    while (last != first && isspace(static_cast<unsigned char>(last[-1]))) {
+        --last;
+    }
+    return std::string_view(first, last - first);
+}
 
-    return std::string(it, rit.base());
+/**
+ * Returns a copy of value without leading and trailing white spaces
+ * @deprecated use trimmed(), which does not copy
+ */
+[[deprecated("use autordf::cvt::trimmed()")]] inline std::string trim(const std::string& s) {
+    return std::string(trimmed(s));
 }
 
-template<typename T> T locale_agnostic_cast(const std::string& value) {
-    std::istringstream iss(trim(value));
+/**
+ * Reads value with operator>> in the classic locale, as conversions did before toCpp checked xsd lexical spaces
+ */
+template<typename T> T streamCast(const std::string& value) {
+    std::istringstream iss{std::string(trimmed(value))};
     iss.imbue(std::locale::classic());
-    iss.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    iss.exceptions(std::ios_base::failbit | std::ios_base::badbit);
     T val;
     iss >> val;
     if ( !iss.eof() ) {
@@ -41,37 +61,183 @@ template<typename T> T locale_agnostic_cast(const std::string& value) {
     return val;
 }
 
-template<typename CppType, RdfTypeEnum rdfType> class toCpp;
+/**
+ * @deprecated use toCpp, which checks the xsd lexical space and does not go through a stream
+ */
+template<typename T> [[deprecated("use autordf::cvt::toCpp")]] T locale_agnostic_cast(const std::string& value) {
+    return streamCast<T>(value);
+}
 
-template<typename CppType> CppType toCppGeneric(const std::string& rawValue) {
+/**
+ * @deprecated use toCpp, which checks the xsd lexical space and does not go through a stream
+ */
+template<typename CppType> [[deprecated("use autordf::cvt::toCpp")]] CppType toCppGeneric(const std::string& rawValue) {
     try {
-        return locale_agnostic_cast<CppType>(rawValue);
+        return streamCast<CppType>(rawValue);
     }
     catch (const std::exception& e) {
         throw DataConvertionFailure("During conversion of " + rawValue + ": " + e.what());
     }
 }
 
-inline boost::posix_time::ptime toCppDateTime(const std::string& rawValue) {
-    try {
-        std::istringstream ss(trim(rawValue));
-        ss.exceptions(std::ios_base::failbit);
-        boost::posix_time::time_input_facet* input_facet = new boost::posix_time::time_input_facet;
-        input_facet->format("%Y-%m-%dT%H:%M:%S%F%Q");
-        ss.imbue(std::locale(std::locale::classic(), input_facet));
-        boost::local_time::local_date_time result(boost::date_time::not_a_date_time);
-        ss >> result;
-        return result.utc_time();
-    } catch (const std::exception& e) {
-        throw DataConvertionFailure("During conversion of " + rawValue + ": " + e.what());
+inline DataConvertionFailure conversionFailure(const std::string& rawValue, const char *reason) {
+    return DataConvertionFailure("During conversion of " + rawValue + ": " + reason);
+}
+
+/**
+ * Constraint on the sign of an xsd integer type, on top of the range of its C++ type
+ */
+enum class IntegerSign { ANY, NON_NEGATIVE, POSITIVE, NON_POSITIVE, NEGATIVE };
+
+/**
+ * Reads an xsd integer literal: optional sign followed by at least one digit, nothing else.
+ * XsdType is the C++ type whose range is the one of the xsd type (std::int32_t for xsd:int...)
+ */
+template<typename XsdType, IntegerSign sign = IntegerSign::ANY> XsdType toCppInteger(const std::string& rawValue) {
+    std::string_view value = trimmed(rawValue);
+    const char *first = value.data();
+    const char *last = first + value.size();
+    bool negative = false;
+    if (first != last && (*first == '+' || *first == '-')) {
+        negative = *first == '-';
+        ++first;
+    }
+    if (first == last) {
+        throw conversionFailure(rawValue, "not an integer");
+    }
+    for (const char *c = first; c != last; ++c) {
+        if (*c < '0' || *c > '9') {
+            throw conversionFailure(rawValue, "extra chars found");
+        }
+    }
+
+    unsigned long long magnitude;
+    if (std::from_chars(first, last, magnitude).ec != std::errc()) {
+        throw conversionFailure(rawValue, "out of range");
+    }
+    XsdType result;
+    if (!negative || magnitude == 0) {
+        if (magnitude > static_cast<unsigned long long>(std::numeric_limits<XsdType>::max())) {
+            throw conversionFailure(rawValue, "out of range");
+        }
+        result = static_cast<XsdType>(magnitude);
+    } else if constexpr (std::is_signed<XsdType>::value) {
+        // -(min + 1) does not overflow, whereas -min does
+        if (magnitude - 1 > static_cast<unsigned long long>(-(std::numeric_limits<XsdType>::min() + 1))) {
+            throw conversionFailure(rawValue, "out of range");
+        }
+        result = -static_cast<XsdType>(magnitude - 1) - 1;
+    } else {
+        throw conversionFailure(rawValue, "out of range");
+    }
+
+    if ((sign == IntegerSign::NON_NEGATIVE && result < 0) || (sign == IntegerSign::POSITIVE && result <= 0) ||
+        (sign == IntegerSign::NON_POSITIVE && result > 0) || (sign == IntegerSign::NEGATIVE && result >= 0)) {
+        throw conversionFailure(rawValue, "out of range");
+    }
+    return result;
+}
+
+/**
+ * Reads an xsd:decimal, xsd:float or xsd:double literal.
+ *
+ * Besides the xsd lexical spaces, the forms toRdfFloatingPoint() has always written are accepted, so that existing
+ * data reads back: exponent in decimals, lower case inf and nan in floats and doubles
+ */
+template<typename CppType> CppType toCppFloatingPoint(const std::string& rawValue, bool allowSpecialValues) {
+    std::string_view value = trimmed(rawValue);
+    const char *first = value.data();
+    const char *last = first + value.size();
+    bool negative = false;
+    if (first != last && (*first == '+' || *first == '-')) {
+        negative = *first == '-';
+        ++first;
+    }
+    std::string_view unsignedValue(first, last - first);
+    if (allowSpecialValues) {
+        if (unsignedValue == "INF" || unsignedValue == "inf") {
+            return negative ? -std::numeric_limits<CppType>::infinity() : std::numeric_limits<CppType>::infinity();
+        }
+        // xsd NaN has no sign, whereas a negative nan is written as -nan
+        if ((unsignedValue == "NaN" && first == value.data()) || (unsignedValue == "nan" && value[0] != '+')) {
+            return negative ? -std::numeric_limits<CppType>::quiet_NaN() : std::numeric_limits<CppType>::quiet_NaN();
+        }
+    }
+
+    // Mantissa: digits with an optional dot, and at least one digit.
+    // Value is lower than 10^scale, so that underflows can be told from overflows
+    const char *c = first;
+    size_t digits = 0;
+    long scale = 0;
+    bool significant = false;
+    while (c != last && *c >= '0' && *c <= '9') {
+        if (significant || *c != '0') {
+            significant = true;
+            ++scale;
+        }
+        ++c;
+        ++digits;
+    }
+    if (c != last && *c == '.') {
+        ++c;
+        while (c != last && *c >= '0' && *c <= '9') {
+            if (!significant) {
+                significant = *c != '0';
+                scale -= !significant;
+            }
+            ++c;
+            ++digits;
+        }
+    }
+    if (!digits) {
+        throw conversionFailure(rawValue, "not a number");
+    }
+    // Exponent
+    if (c != last && (*c == 'e' || *c == 'E')) {
+        ++c;
+        bool negativeExponent = false;
+        if (c != last && (*c == '+' || *c == '-')) {
+            negativeExponent = *c == '-';
+            ++c;
+        }
+        if (c == last) {
+            throw conversionFailure(rawValue, "not a number");
+        }
+        long exponent = 0;
+        while (c != last && *c >= '0' && *c <= '9') {
+            exponent = std::min(exponent * 10 + (*c - '0'), 1000000L);
+            ++c;
+        }
+        scale += negativeExponent ? -exponent : exponent;
+    }
+    if (c != last) {
+        throw conversionFailure(rawValue, "extra chars found");
+    }
+
+    CppType result;
+    if (std::from_chars(first, last, result).ec != std::errc()) {
+        if (scale > 0) {
+            throw conversionFailure(rawValue, "out of range");
+        }
+        // Too small to be represented: rounds to zero
+        result = 0;
     }
+    return negative ? -result : result;
+}
+
+template<typename CppType, RdfTypeEnum rdfType> class toCpp;
+
+#define INTEGER_TOCPP(cppType, rdfType, xsdType, sign) \
+template<> class toCpp<cppType, RdfTypeEnum::rdfType> { \
+public: \
+    static cppType val(const std::string& rawValue) { return toCppInteger<xsdType, IntegerSign::sign>(rawValue); } \
 };
 
-#define GENERIC_TOCPP(cppType, rdfType) \
+#define FLOATINGPOINT_TOCPP(cppType, rdfType, allowSpecialValues) \
 template<> class toCpp<cppType, RdfTypeEnum::rdfType> { \
 public: \
-    static cppType val(const std::string& rawValue) { return toCppGeneric<cppType>(rawValue); } \
-}; \
+    static cppType val(const std::string& rawValue) { return toCppFloatingPoint<cppType>(rawValue, allowSpecialValues); } \
+};
 
 // xsd:string
 template<RdfTypeEnum rdfType> class toCpp<std::string, rdfType> {
@@ -94,28 +260,28 @@ public:
 };
 
 // xsd:integer
-GENERIC_TOCPP(long long int, xsd_integer)
+INTEGER_TOCPP(long long int, xsd_integer, long long int, ANY)
 
 // xsd:decimal
-GENERIC_TOCPP(double, xsd_decimal)
+FLOATINGPOINT_TOCPP(double, xsd_decimal, false)
 
 // xsd:float
-GENERIC_TOCPP(float, xsd_float)
+FLOATINGPOINT_TOCPP(float, xsd_float, true)
 
 // xsd:double
-GENERIC_TOCPP(double, xsd_double)
+FLOATINGPOINT_TOCPP(double, xsd_double, true)
 
 // xsd:boolean
 template<typename CppType> class toCpp<CppType, RdfTypeEnum::xsd_boolean> {
 public:
     static CppType val(const std::string& rawValue) {
-        std::string left = trim(rawValue);
+        std::string_view left = trimmed(rawValue);
         if ( left == "true" || left == "1") {
             return true;
         } else if ( left == "false" || left == "0") {
             return false;
         } else {
-            throw DataConvertionFailure("Invalid value '" + left + "' for boolean");
+            throw DataConvertionFailure("Invalid value '" + std::string(left) + "' for boolean");
         }
     }
 };
@@ -136,41 +302,56 @@ public:
     }
 };
 
+// xsd:dateTime and xsd:dateTimeStamp, as std::chrono system clock time points
+template<typename Duration> class toCpp<std::chrono::sys_time<Duration>, RdfTypeEnum::xsd_dateTime> {
+public:
+    static std::chrono::sys_time<Duration> val(const std::string& rawValue) {
+        return toCppChronoDateTime<Duration>(rawValue);
+    }
+};
+
+template<typename Duration> class toCpp<std::chrono::sys_time<Duration>, RdfTypeEnum::xsd_dateTimeStamp> {
+public:
+    static std::chrono::sys_time<Duration> val(const std::string& rawValue) {
+        return toCppChronoDateTime<Duration>(rawValue);
+    }
+};
+
 // xsd:nonNegativeInteger
-GENERIC_TOCPP(long long unsigned int, xsd_nonNegativeInteger)
+INTEGER_TOCPP(long long unsigned int, xsd_nonNegativeInteger, long long unsigned int, NON_NEGATIVE)
 
 // xsd:positiveInteger
-GENERIC_TOCPP(long long unsigned int, xsd_positiveInteger)
+INTEGER_TOCPP(long long unsigned int, xsd_positiveInteger, long long unsigned int, POSITIVE)
 
 // xsd:nonPositiveInteger
-GENERIC_TOCPP(long long int, xsd_nonPositiveInteger)
+INTEGER_TOCPP(long long int, xsd_nonPositiveInteger, long long int, NON_POSITIVE)
 
 // xsd:negativeInteger
-GENERIC_TOCPP(long long int, xsd_negativeInteger)
+INTEGER_TOCPP(long long int, xsd_negativeInteger, long long int, NEGATIVE)
 
 // xsd:long
-GENERIC_TOCPP(long long int, xsd_long)
+INTEGER_TOCPP(long long int, xsd_long, std::int64_t, ANY)
 
 // xsd:unsignedLong
-GENERIC_TOCPP(long long unsigned int, xsd_unsignedLong)
+INTEGER_TOCPP(long long unsigned int, xsd_unsignedLong, std::uint64_t, ANY)
 
 // xsd:int
-GENERIC_TOCPP(long int, xsd_int)
+INTEGER_TOCPP(long int, xsd_int, std::int32_t, ANY)
 
 // xsd:unsignedInt
-GENERIC_TOCPP(long unsigned int, xsd_unsignedInt)
+INTEGER_TOCPP(long unsigned int, xsd_unsignedInt, std::uint32_t, ANY)
 
 // xsd:short
-GENERIC_TOCPP(short, xsd_short)
+INTEGER_TOCPP(short, xsd_short, std::int16_t, ANY)
 
 // xsd:unsignedShort
-GENERIC_TOCPP(unsigned short, xsd_unsignedShort)
+INTEGER_TOCPP(unsigned short, xsd_unsignedShort, std::uint16_t, ANY)
 
 // xsd:byte
 template<> class toCpp<char, RdfTypeEnum::xsd_byte> {
 public:
     static char val(const std::string& rawValue) {
-        return locale_agnostic_cast<short>(rawValue);
+        return static_cast<char>(toCppInteger<std::int8_t>(rawValue));
     }
 };
 
@@ -178,7 +359,7 @@ public:
 template<> class toCpp<unsigned char, RdfTypeEnum::xsd_unsignedByte> {
 public:
     static unsigned char val(const std::string& rawValue) {
-        return locale_agnostic_cast<unsigned short>(rawValue);
+        return toCppInteger<std::uint8_t>(rawValue);
     }
 };
 
@@ -190,6 +371,32 @@ template<RdfTypeEnum rdfType, typename CppType> std::string toRdfGeneric(const C
     return ss.str();
 };
 
+template<typename CppType> std::string toRdfInteger(CppType cppValue) {
+    // Room for sign and digits of any 64 bits integer
+    char buffer[24];
+    return std::string(buffer, std::to_chars(buffer, buffer + sizeof(buffer), cppValue).ptr);
+}
+
+/**
+ * Writes a floating point value as an std::ostream with default settings does: %g with a precision of 6
+ */
+template<typename CppType> std::string toRdfFloatingPoint(CppType cppValue) {
+    char buffer[32];
+    return std::string(buffer, std::to_chars(buffer, buffer + sizeof(buffer), cppValue, std::chars_format::general, 6).ptr);
+}
+
+#define INTEGER_TORDF(cppType, rdfType) \
+template<> class toRdf<cppType, RdfTypeEnum::rdfType> { \
+public: \
+    static std::string val(const cppType& cppValue) { return toRdfInteger(cppValue); } \
+};
+
+#define FLOATINGPOINT_TORDF(cppType, rdfType) \
+template<> class toRdf<cppType, RdfTypeEnum::rdfType> { \
+public: \
+    static std::string val(const cppType& cppValue) { return toRdfFloatingPoint(cppValue); } \
+};
+
 #define GENERIC_TORDF(cppType, rdfType) \
 template<> class toRdf<cppType, RdfTypeEnum::rdfType> { \
 public: \
@@ -203,16 +410,16 @@ GENERIC_TORDF(std::string, xsd_string)
 GENERIC_TORDF(autordf::I18String, rdf_langString)
 
 // xsd:integer
-GENERIC_TORDF(long long int, xsd_integer)
+INTEGER_TORDF(long long int, xsd_integer)
 
 // xsd:decimal
-GENERIC_TORDF(double, xsd_decimal)
+FLOATINGPOINT_TORDF(double, xsd_decimal)
 
 // xsd:float
-GENERIC_TORDF(float, xsd_float)
+FLOATINGPOINT_TORDF(float, xsd_float)
 
 // xsd:double
-GENERIC_TORDF(double, xsd_double)
+FLOATINGPOINT_TORDF(double, xsd_double)
 
 // xsd:boolean
 template<typename CppType> class toRdf<CppType, RdfTypeEnum::xsd_boolean>  {
@@ -222,17 +429,6 @@ public:
     }
 };
 
-inline std::string toRdfDateTime(const boost::posix_time::ptime& time) {
-    std::ostringstream ss;
-    ss.exceptions(std::ios_base::failbit);
-    boost::posix_time::time_facet* facet = new boost::posix_time::time_facet;
-    // ISO Extended with Z as forced timezone
-    facet->format("%Y-%m-%dT%H:%M:%S%FZ");
-    ss.imbue(std::locale(std::locale::classic(), facet));
-    ss << time;
-    return ss.str();
-}
-
 // xsd:dateTime
 template<> class toRdf<boost::posix_time::ptime, RdfTypeEnum::xsd_dateTime> {
 public:
@@ -249,43 +445,56 @@ public:
     }
 };
 
+// xsd:dateTime and xsd:dateTimeStamp, as std::chrono system clock time points
+template<typename Duration> class toRdf<std::chrono::sys_time<Duration>, RdfTypeEnum::xsd_dateTime> {
+public:
+    static std::string val(const std::chrono::sys_time<Duration>& time) {
+        return toRdfChronoDateTime(time);
+    }
+};
+
+template<typename Duration> class toRdf<std::chrono::sys_time<Duration>, RdfTypeEnum::xsd_dateTimeStamp> {
+public:
+    static std::string val(const std::chrono::sys_time<Duration>& time) {
+        return toRdfChronoDateTime(time);
+    }
+};
+
 // xsd:nonNegativeInteger
-GENERIC_TORDF(long long unsigned int, xsd_nonNegativeInteger)
+INTEGER_TORDF(long long unsigned int, xsd_nonNegativeInteger)
 
 // xsd:positiveInteger
-GENERIC_TORDF(long long unsigned int, xsd_positiveInteger)
+INTEGER_TORDF(long long unsigned int, xsd_positiveInteger)
 
 // xsd:nonPositiveInteger
-GENERIC_TORDF(long long int, xsd_nonPositiveInteger)
+INTEGER_TORDF(long long int, xsd_nonPositiveInteger)
 
 // xsd:negativeInteger
-GENERIC_TORDF(long long int, xsd_negativeInteger)
+INTEGER_TORDF(long long int, xsd_negativeInteger)
 
 // xsd:long
-GENERIC_TORDF(long long int, xsd_long)
+INTEGER_TORDF(long long int, xsd_long)
 
 // xsd:unsignedLong
-GENERIC_TORDF(long long unsigned int, xsd_unsignedLong)
+INTEGER_TORDF(long long unsigned int, xsd_unsignedLong)
 
 // xsd:int
-GENERIC_TORDF(long int, xsd_int)
+INTEGER_TORDF(long int, xsd_int)
 
 // xsd:unsignedInt
-GENERIC_TORDF(long unsigned int, xsd_unsignedInt)
+INTEGER_TORDF(long unsigned int, xsd_unsignedInt)
 
 // xsd:short
-GENERIC_TORDF(short, xsd_short)
+INTEGER_TORDF(short, xsd_short)
 
 // xsd:unsignedShort
-GENERIC_TORDF(unsigned short, xsd_unsignedShort)
+INTEGER_TORDF(unsigned short, xsd_unsignedShort)
 
 // xsd:byte
 template<> class toRdf<char, RdfTypeEnum::xsd_byte>  {
 public:
     static std::string val(char cppValue) {
-        std::ostringstream ss;
-        ss << static_cast<short>(cppValue);
-        return ss.str();
+        return toRdfInteger(static_cast<short>(cppValue));
     }
 };
 
@@ -293,9 +502,7 @@ public:
 template<> class toRdf<unsigned char, RdfTypeEnum::xsd_unsignedByte>  {
 public:
     static std::string val(unsigned char cppValue) {
-        std::ostringstream ss;
-        ss << static_cast<unsigned short>(cppValue);
-        return ss.str();
+        return toRdfInteger(static_cast<unsigned short>(cppValue));
     }
 };
 
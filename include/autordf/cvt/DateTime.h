@@ -0,0 +1,299 @@
+#ifndef AUTORDF_CVT_DATETIME_H
+#define AUTORDF_CVT_DATETIME_H
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <autordf/Exception.h>
+
+namespace autordf {
+namespace cvt {
+
+// @cond internal
+
+/**
+ * Fields of an xsd:dateTime literal, as written, time zone offset not applied
+ */
+struct DateTimeFields {
+    long year = 0;
+    unsigned int month = 1;
+    unsigned int day = 1;
+    unsigned int hour = 0;
+    unsigned int minute = 0;
+    unsigned int second = 0;
+    /** Fractional part of seconds, in nanoseconds */
+    std::uint32_t nanosecond = 0;
+    /** Time zone offset in minutes, positive east of UTC. Zero when not given: time is UTC */
+    int timezoneOffset = 0;
+};
+
+/**
+ * Longest literal formatDateTime() writes, sign and digits of years beyond 9999 included
+ */
+const size_t DATETIME_MAX_LENGTH = 48;
+
+inline bool isLeapYear(long year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+inline unsigned int daysInMonth(long year, unsigned int month) {
+    static const unsigned char DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && isLeapYear(year) ? 29 : DAYS[month - 1];
+}
+
+/**
+ * Reads exactly count digits
+ */
+inline bool readDigits(const char *& c, const char *last, int count, unsigned int *value) {
+    *value = 0;
+    for (int i = 0; i < count; ++i, ++c) {
+        if (c == last || *c < '0' || *c > '9') {
+            return false;
+        }
+        *value = *value * 10 + (*c - '0');
+    }
+    return true;
+}
+
+inline bool readChar(const char *& c, const char *last, char expected) {
+    if (c != last && *c == expected) {
+        ++c;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Parses an xsd:dateTime literal: [-]YYYY-MM-DDThh:mm:ss[.s+][Z|(+|-)hh:mm], surrounding white spaces ignored.
+ *
+ * A few ISO-8601 forms are also accepted, as they always have been: a space instead of the T separator,
+ * missing seconds, missing time (midnight).
+ * Digits of fractional seconds after the nanosecond are ignored.
+ * @throw DataConvertionFailure if literal does not match or one of its fields is out of range
+ */
+inline DateTimeFields parseDateTime(const std::string& rawValue) {
+    auto failure = [&rawValue](const char *reason) {
+        return DataConvertionFailure("During conversion of " + rawValue + ": " + reason);
+    };
+
+    const char *c = rawValue.data();
+    const char *last = c + rawValue.size();
+    while (c != last && isspace(static_cast<unsigned char>(*c))) {
+        ++c;
+    }
+    while (last != c && isspace(static_cast<unsigned char>(last[-1]))) {
+        --last;
+    }
+
+    DateTimeFields fields;
+    // Year has at least 4 digits, and no leading zero when it has more
+    bool negativeYear = readChar(c, last, '-');
+    const char *yearStart = c;
+    while (c != last && *c >= '0' && *c <= '9') {
+        if (c - yearStart >= 9) {
+            throw failure("year out of range");
+        }
+        fields.year = fields.year * 10 + (*c - '0');
+        ++c;
+    }
+    if (c - yearStart < 4 || (c - yearStart > 4 && *yearStart == '0')) {
+        throw failure("invalid year");
+    }
+    if (negativeYear) {
+        fields.year = -fields.year;
+    }
+    if (!readChar(c, last, '-') || !readDigits(c, last, 2, &fields.month) ||
+        !readChar(c, last, '-') || !readDigits(c, last, 2, &fields.day)) {
+        throw failure("invalid date");
+    }
+    if (fields.month < 1 || fields.month > 12 || fields.day < 1 || fields.day > daysInMonth(fields.year, fields.month)) {
+        throw failure("date out of range");
+    }
+
+    if (readChar(c, last, 'T') || readChar(c, last, ' ')) {
+        if (!readDigits(c, last, 2, &fields.hour) || !readChar(c, last, ':') || !readDigits(c, last, 2, &fields.minute)) {
+            throw failure("invalid time");
+        }
+        if (readChar(c, last, ':')) {
+            if (!readDigits(c, last, 2, &fields.second)) {
+                throw failure("invalid time");
+            }
+            if (readChar(c, last, '.')) {
+                const char *fractionStart = c;
+                std::uint32_t scale = 100000000;
+                while (c != last && *c >= '0' && *c <= '9') {
+                    fields.nanosecond += (*c - '0') * scale;
+                    scale /= 10;
+                    ++c;
+                }
+                if (c == fractionStart) {
+                    throw failure("invalid fractional seconds");
+                }
+            }
+        }
+        // 24:00:00 is the first instant of next day, seconds up to 60 for leap seconds
+        bool endOfDay = fields.hour == 24 && fields.minute == 0 && fields.second == 0 && fields.nanosecond == 0;
+        if ((fields.hour > 23 && !endOfDay) || fields.minute > 59 || fields.second > 60) {
+            throw failure("time out of range");
+        }
+
+        if (!readChar(c, last, 'Z') && c != last) {
+            int sign = *c == '+' ? 1 : (*c == '-' ? -1 : 0);
+            unsigned int tzHour, tzMinute;
+            ++c;
+            if (!sign || !readDigits(c, last, 2, &tzHour) || !readChar(c, last, ':') || !readDigits(c, last, 2, &tzMinute)) {
+                throw failure("invalid time zone");
+            }
+            if (tzMinute > 59 || tzHour * 60 + tzMinute > 14 * 60) {
+                throw failure("time zone out of range");
+            }
+            fields.timezoneOffset = sign * static_cast<int>(tzHour * 60 + tzMinute);
+        }
+    }
+    if (c != last) {
+        throw failure("extra chars found");
+    }
+    return fields;
+}
+
+inline char *writeDigits(char *out, unsigned long value, int count) {
+    for (int i = count - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + count;
+}
+
+/**
+ * Writes YYYY-MM-DDThh:mm:ss[.fraction]Z, fraction being written only when not null, with fractionDigits digits
+ * @param out buffer of at least DATETIME_MAX_LENGTH chars
+ * @return end of written chars
+ */
+inline char *formatDateTime(long year, unsigned int month, unsigned int day, unsigned int hour, unsigned int minute,
+                            unsigned int second, unsigned long fraction, int fractionDigits, char *out) {
+    if (year < 0) {
+        *out++ = '-';
+        year = -year;
+    }
+    int yearDigits = 4;
+    for (long y = year / 10000; y; y /= 10) {
+        ++yearDigits;
+    }
+    out = writeDigits(out, year, yearDigits);
+    *out++ = '-';
+    out = writeDigits(out, month, 2);
+    *out++ = '-';
+    out = writeDigits(out, day, 2);
+    *out++ = 'T';
+    out = writeDigits(out, hour, 2);
+    *out++ = ':';
+    out = writeDigits(out, minute, 2);
+    *out++ = ':';
+    out = writeDigits(out, second, 2);
+    if (fraction) {
+        *out++ = '.';
+        out = writeDigits(out, fraction, fractionDigits);
+    }
+    *out++ = 'Z';
+    return out;
+}
+
+/**
+ * Converts xsd:dateTime literal to UTC time, applying time zone offset
+ * @throw DataConvertionFailure
+ */
+inline boost::posix_time::ptime toCppDateTime(const std::string& rawValue) {
+    using namespace boost::posix_time;
+    // Special values, as written by toRdfDateTime()
+    if (rawValue == "not-a-date-time") {
+        return ptime(boost::date_time::not_a_date_time);
+    } else if (rawValue == "+infinity") {
+        return ptime(boost::date_time::pos_infin);
+    } else if (rawValue == "-infinity") {
+        return ptime(boost::date_time::neg_infin);
+    }
+    DateTimeFields fields = parseDateTime(rawValue);
+    if (fields.year < 1400 || fields.year > 9999) {
+        throw DataConvertionFailure("During conversion of " + rawValue + ": year out of range");
+    }
+    const std::int64_t nanosecondsPerTick = 1000000000 / time_duration::ticks_per_second();
+    time_duration time = hours(fields.hour) + minutes(static_cast<long>(fields.minute) - fields.timezoneOffset) +
+                         seconds(fields.second) + time_duration(0, 0, 0, fields.nanosecond / nanosecondsPerTick);
+    ptime result;
+    try {
+        result = ptime(boost::gregorian::date(fields.year, fields.month, fields.day), time);
+    } catch (const std::out_of_range& e) {
+        throw DataConvertionFailure("During conversion of " + rawValue + ": " + e.what());
+    }
+    // Time zone offset may move a date of year 1400 or 9999 out of boost range, which ptime does not check
+    if (result < ptime(boost::date_time::min_date_time) || result > ptime(boost::date_time::max_date_time)) {
+        throw DataConvertionFailure("During conversion of " + rawValue + ": year out of range");
+    }
+    return result;
+}
+
+/**
+ * Writes UTC time as xsd:dateTime literal, with Z time zone.
+ * Special values are written as boost names them: not-a-date-time, +infinity, -infinity
+ */
+inline std::string toRdfDateTime(const boost::posix_time::ptime& time) {
+    if (time.is_special()) {
+        return boost::posix_time::to_simple_string(time);
+    }
+    const boost::gregorian::date::ymd_type ymd = time.date().year_month_day();
+    const boost::posix_time::time_duration timeOfDay = time.time_of_day();
+    char buffer[DATETIME_MAX_LENGTH];
+    char *end = formatDateTime(ymd.year, ymd.month, ymd.day, timeOfDay.hours(), timeOfDay.minutes(), timeOfDay.seconds(),
+                               timeOfDay.fractional_seconds(), boost::posix_time::time_duration::num_fractional_digits(),
+                               buffer);
+    return std::string(buffer, end);
+}
+
+/**
+ * Converts xsd:dateTime literal to std::chrono system clock time point
+ * @throw DataConvertionFailure
+ */
+template<typename Duration> std::chrono::sys_time<Duration> toCppChronoDateTime(const std::string& rawValue) {
+    using namespace std::chrono;
+    DateTimeFields fields = parseDateTime(rawValue);
+    if (fields.year < static_cast<int>(year::min()) || fields.year > static_cast<int>(year::max())) {
+        throw DataConvertionFailure("During conversion of " + rawValue + ": year out of range");
+    }
+    const year_month_day ymd(year(fields.year), month(fields.month), day(fields.day));
+    if (!ymd.ok()) {
+        throw DataConvertionFailure("During conversion of " + rawValue + ": invalid date");
+    }
+    sys_days date = ymd;
+    sys_seconds time = date + hours(fields.hour) + minutes(static_cast<long>(fields.minute) - fields.timezoneOffset) +
+                       seconds(fields.second);
+    // Fraction is added last: a time point in nanoseconds only spans years 1678 to 2261
+    return time_point_cast<Duration>(time) + duration_cast<Duration>(nanoseconds(fields.nanosecond));
+}
+
+/**
+ * Writes std::chrono system clock time point as xsd:dateTime literal, with Z time zone
+ */
+template<typename Duration> std::string toRdfChronoDateTime(const std::chrono::sys_time<Duration>& time) {
+    using namespace std::chrono;
+    const auto date = floor<days>(time);
+    const year_month_day ymd(date);
+    const hh_mm_ss<Duration> timeOfDay(time - date);
+    char buffer[DATETIME_MAX_LENGTH];
+    char *end = formatDateTime(static_cast<int>(ymd.year()), static_cast<unsigned int>(ymd.month()),
+                               static_cast<unsigned int>(ymd.day()), timeOfDay.hours().count(),
+                               timeOfDay.minutes().count(), timeOfDay.seconds().count(),
+                               timeOfDay.subseconds().count(), hh_mm_ss<Duration>::fractional_width, buffer);
+    return std::string(buffer, end);
+}
+
+// @endcond internal
+
+}
+}
+
+#endif //AUTORDF_CVT_DATETIME_H
@@ -0,0 +1,101 @@
+#ifndef AUTORDF_ONTOLOGY_INCREMENTALVALIDATOR_H
+#define AUTORDF_ONTOLOGY_INCREMENTALVALIDATOR_H
+
+#include <map>
+#include <set>
+#include <string>
+
+#include <autordf/Object.h>
+#include <autordf/notification/ANotifier.h>
+#include <autordf/ontology/Validator.h>
+#include <autordf/ontology/autordf-ontology_export.h>
+
+namespace autordf {
+namespace ontology {
+namespace validation {
+
+/**
+ * Keeps a live list of validation errors for a model, checking again only what was modified.
+ *
+ * Install it as the model notifier using Model::setNotifier(): added and removed statements are recorded,
+ * and revalidate() then checks again their subjects, the objects pointing to subjects whose rdf:type changed
+ * (their range may not be satisfied anymore), and the keys of the classes of these subjects.
+ *
+ * Typical usage:
+ * @code
+ * auto validator = std::make_shared<IncrementalValidator>(ontology, option);
+ * factory.setNotifier(validator);
+ * validator->validateAll();
+ * ... edit model ...
+ * const Error::Vec& errors = validator->revalidate();
+ * @endcode
+ */
+class IncrementalValidator : public notification::ANotifier {
+public:
+    /**
+     * @param ontology ontology to check model against. Must outlive the validator
+     * @param option validation options, as for validateModel()
+     */
+    AUTORDF_ONTOLOGY_EXPORT explicit IncrementalValidator(const Ontology& ontology,
+                                                          const ValidationOption& option = ValidationOption());
+
+    AUTORDF_ONTOLOGY_EXPORT void added(const Statement& stmt) override;
+
+    AUTORDF_ONTOLOGY_EXPORT void removed(const Statement& stmt) override;
+
+    /**
+     * Checks all the model resources, discarding previously known errors.
+     * @return the live error list
+     */
+    AUTORDF_ONTOLOGY_EXPORT const Error::Vec& validateAll();
+
+    /**
+     * Checks again what has been modified since last validateAll() or revalidate() call.
+     * @return the live error list
+     */
+    AUTORDF_ONTOLOGY_EXPORT const Error::Vec& revalidate();
+
+    /**
+     * The live error list, as of last validateAll() or revalidate() call
+     */
+    const Error::Vec& errors() const { return _errors; }
+
+    /**
+     * True if statements were modified since last validateAll() or revalidate() call
+     */
+    bool isDirty() const { return !_touchedSubjects.empty() || !_retypedSubjects.empty() || !_touchedClasses.empty(); }
+
+private:
+    const Ontology& _ontology;
+    ValidationOption _option;
+
+    /** Subjects whose properties were modified */
+    std::set<Object> _touchedSubjects;
+    /** Subjects whose rdf:type was modified: resources pointing to them must be checked again */
+    std::set<Object> _retypedSubjects;
+    /** Classes an instance was added to or removed from: their keys must be checked again */
+    std::set<std::string> _touchedClasses;
+
+    /** Errors of each resource, without key errors */
+    std::map<Object, Error::Vec> _objectErrors;
+    /** Key errors of each class */
+    std::map<std::string, Error::Vec> _keyErrors;
+    /** Concatenation of _objectErrors and _keyErrors */
+    Error::Vec _errors;
+
+    void aggregationFinished() override;
+
+    void record(const Statement& stmt);
+
+    void validateClassesKeys(const std::set<std::string>& classes);
+
+    void collectClasses(const Object& object, std::set<std::string> *classes) const;
+
+    void rebuildErrors();
+};
+
+}
+}
+}
+
+#endif //AUTORDF_ONTOLOGY_INCREMENTALVALIDATOR_H
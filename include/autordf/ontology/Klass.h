@@ -5,6 +5,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <limits>
+
+#include <boost/dynamic_bitset.hpp>
 
 #include "RdfsEntity.h"
 #include "AnnotationProperty.h"
@@ -113,6 +116,29 @@ public:
      */
     AUTORDF_ONTOLOGY_EXPORT std::set<std::shared_ptr<const Klass> > getAllPredecessors() const;
 
+    /**
+     * Dense index of this class in its ontology, see Ontology::classAt()
+     */
+    size_t index() const { return _index; }
+
+    /**
+     * Returns true if this class is other, or one of its direct or indirect subclasses.
+     * Runs in constant time, using the hierarchy closure computed when the ontology was loaded
+     */
+    bool isSubClassOf(const Klass& other) const {
+        return _index == other._index || (other._index < _allAncestors.size() && _allAncestors.test(other._index));
+    }
+
+    /**
+     * All (direct and indirect) ancestors for this class, as a set of class indexes
+     */
+    const boost::dynamic_bitset<>& allAncestorsMask() const { return _allAncestors; }
+
+    /**
+     * All (direct and indirect) predecessors for this class, as a set of class indexes
+     */
+    const boost::dynamic_bitset<>& allPredecessorsMask() const { return _allPredecessors; }
+
     /*
      * ===================================================================
      * All methods below are purely internal
@@ -157,6 +183,12 @@ private:
     // owl:hasKey
     std::set<std::string> _keys;
 
+    // Class hierarchy, computed once all classes are loaded
+    size_t _index = std::numeric_limits<size_t>::max();
+    boost::dynamic_bitset<> _directPredecessors;
+    boost::dynamic_bitset<> _allAncestors;
+    boost::dynamic_bitset<> _allPredecessors;
+
     friend class Ontology;
 };
 
@@ -3,19 +3,24 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <memory>
+#include <iosfwd>
 
+#include <autordf/Exception.h>
 #include <autordf/ontology/autordf-ontology_export.h>
 
 #include "autordf/ontology/Klass.h"
 #include "autordf/ontology/DataProperty.h"
 #include "autordf/ontology/ObjectProperty.h"
 #include "autordf/ontology/AnnotationProperty.h"
+#include "autordf/ontology/ValidationPlan.h"
 
 namespace autordf {
 
 class Factory;
 class Model;
+class Node;
 class Object;
 
 namespace ontology {
@@ -26,6 +31,13 @@ class Klass;
 
 class Property;
 
+class SchemaIndex;
+
+/**
+ * Binary ontology cache can not be read back
+ */
+AUTORDFEXCEPTION(InvalidOntologyCache)
+
 /**
  * Maps an OWL or RDFS Ontology to set of more readily accessible C++ objects
  */
@@ -38,6 +50,23 @@ public:
      */
     AUTORDF_ONTOLOGY_EXPORT Ontology(const Factory *f, bool verbose = false);
 
+    /**
+     * Reads back an ontology written by save(), instead of extracting it from the model
+     * @param f the model the ontology was extracted from
+     * @param cache stream save() wrote to
+     * @param key if not empty, must be the key given to save()
+     * @param verbose if true prints debug output to standard output
+     * @throw InvalidOntologyCache if stream is truncated, or was written by another format version or for another key
+     */
+    AUTORDF_ONTOLOGY_EXPORT Ontology(const Factory *f, std::istream& cache, const std::string& key = "", bool verbose = false);
+
+    /**
+     * Writes ontology in a compact binary form, that the stream constructor reads back
+     * @param cache where to write
+     * @param key identifies the ontology sources, see OntologyCache::fingerprint()
+     */
+    AUTORDF_ONTOLOGY_EXPORT void save(std::ostream& cache, const std::string& key = "") const;
+
     /**
      * Finds class using IRI
      * @throw std::out_of_range if not found
@@ -54,6 +83,20 @@ public:
      */
     const std::map<std::string, std::shared_ptr<Klass>>& classUri2Ptr() const { return _classUri2Ptr; }
 
+    /**
+     * Finds class using its dense index, see Klass::index()
+     * @throw std::out_of_range if index is not lower than classUri2Ptr().size()
+     */
+    const std::shared_ptr<Klass>& classAt(size_t index) const { return _classes.at(index); }
+
+    /**
+     * Returns true if class subClassIri is class superClassIri, or one of its direct or indirect subclasses
+     * @throw std::out_of_range if one of the classes is not found
+     */
+    bool isSubClassOf(const std::string& subClassIri, const std::string& superClassIri) const {
+        return _classUri2Ptr.at(subClassIri)->isSubClassOf(*_classUri2Ptr.at(superClassIri));
+    }
+
     /**
      * Finds object property using IRI
      * @throw std::out_of_range if not found
@@ -86,6 +129,12 @@ public:
      */
     const std::map<std::string, std::shared_ptr<DataProperty> >& dataPropertyUri2Ptr() const { return _dataPropertyUri2Ptr; }
 
+    /**
+     * Finds the validation rules for instances of class using IRI
+     * @throw std::out_of_range if not found
+     */
+    const ValidationPlan& validationPlan(const std::string& iri) const { return *_validationPlans.at(iri); }
+
     /**
      * The model this ontology has been loaded from
      */
@@ -117,6 +166,21 @@ private:
      */
     void populateSchemaClasses(const Factory *f);
 
+    /**
+     * Reads ontology from a stream written by save()
+     */
+    void restore(std::istream& cache, const std::string& key);
+
+    /**
+     * Indexes classes, and computes ancestors and predecessors closures, once all classes are known
+     */
+    void computeClassHierarchy();
+
+    /**
+     * Flattens validation rules of each class, once all classes are known
+     */
+    void buildValidationPlans();
+
     /**
      * Adds or overwrites the object in static map
      */
@@ -145,29 +209,29 @@ private:
     const Factory *_f;
 
     std::map<std::string, std::shared_ptr<Klass>> _classUri2Ptr;
+    std::vector<std::shared_ptr<Klass>> _classes;
     std::map<std::string, std::shared_ptr<AnnotationProperty> > _annotationPropertyUri2Ptr;
     std::map<std::string, std::shared_ptr<ObjectProperty> > _objectPropertyUri2Ptr;
     std::map<std::string, std::shared_ptr<DataProperty> > _dataPropertyUri2Ptr;
+    std::map<std::string, std::shared_ptr<const ValidationPlan> > _validationPlans;
 
-    void extractRDFS(const Object& o, RdfsEntity *rdfs);
-
-    void extractClassCardinality(const Object& o, Klass *kls, const char *card, const char *minCard,
-                                        const char *maxCard);
+    void extractRDFS(const SchemaIndex& index, const Node& o, RdfsEntity *rdfs);
 
-    void extractClass(const Object& o, Klass *kls);
+    void extractClassCardinality(const SchemaIndex& index, const Node& o, const std::string& propertyIRI, Klass *kls,
+                                 const char *card, const char *minCard, const char *maxCard);
 
-    void extractProperty(const Object& o, Property *prop);
+    void extractClass(const SchemaIndex& index, const Node& o, Klass *kls);
 
-    void extractClass(const Object& rdfsClass);
+    void extractProperty(const SchemaIndex& index, const Node& o, Property *prop);
 
-    void extractClasses(const std::string& classTypeIRI);
+    void extractClasses(const SchemaIndex& index, const std::string& classTypeIRI);
 
     /**
      * Get information from loaded ontology on annotation property and hard code what is missing
      * @param iri
      * @param label
      */
-    void addHardcodedAnnotationProperty(const std::string& iri, const std::string& label);
+    void addHardcodedAnnotationProperty(const SchemaIndex& index, const std::string& iri, const std::string& label);
 };
 }
 }
@@ -0,0 +1,73 @@
+#ifndef AUTORDF_ONTOLOGY_ONTOLOGYCACHE_H
+#define AUTORDF_ONTOLOGY_ONTOLOGYCACHE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <autordf/ontology/Ontology.h>
+#include <autordf/ontology/autordf-ontology_export.h>
+
+namespace autordf {
+
+class Factory;
+
+namespace ontology {
+
+/**
+ * Stores an Ontology in a binary file, so that it is not extracted again from the model at each startup
+ * as long as the ontology files do not change.
+ *
+ * Typical usage:
+ * @code
+ * Factory f;
+ * for ( const std::string& file : files ) {
+ *     f.loadFromFile(file);
+ * }
+ * std::unique_ptr<Ontology> ontology = OntologyCache("ontology.cache", files, f.namespacesPrefixes(), f.baseUri()).load(&f);
+ * @endcode
+ */
+class OntologyCache {
+public:
+    /**
+     * @param cacheFile binary file to read ontology from, or to write it to
+     * @param inputFiles the files the ontology is loaded from. Cache is discarded as soon as one of them changes
+     * @param namespacesPrefixes prefixes the model maps to namespaces. Cache is discarded when they change
+     * @param baseIRI base IRI of the model. Cache is discarded when it changes
+     * @throw FileIOError if one of the input files can not be read
+     */
+    AUTORDF_ONTOLOGY_EXPORT OntologyCache(const std::string& cacheFile, const std::vector<std::string>& inputFiles,
+                                          const std::map<std::string, std::string>& namespacesPrefixes = {},
+                                          const std::string& baseIRI = "");
+
+    /**
+     * Reads ontology from cache file if it was written for the same input files content.
+     * Otherwise extracts it from the model, and writes cache file for next time
+     * @param f model the input files were loaded into
+     * @param verbose if true prints debug output to standard output
+     */
+    AUTORDF_ONTOLOGY_EXPORT std::unique_ptr<Ontology> load(const Factory *f, bool verbose = false) const;
+
+    /**
+     * Key the cache file is written with
+     */
+    const std::string& key() const { return _key; }
+
+    /**
+     * Hash of the content of the given files, of the namespaces prefixes and of the base IRI, as an hexadecimal string
+     * @throw FileIOError if one of the files can not be read
+     */
+    AUTORDF_ONTOLOGY_EXPORT static std::string fingerprint(const std::vector<std::string>& inputFiles,
+                                                           const std::map<std::string, std::string>& namespacesPrefixes = {},
+                                                           const std::string& baseIRI = "");
+
+private:
+    std::string _cacheFile;
+    std::string _key;
+};
+
+}
+}
+
+#endif //AUTORDF_ONTOLOGY_ONTOLOGYCACHE_H
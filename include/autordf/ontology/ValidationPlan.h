@@ -0,0 +1,145 @@
+#ifndef AUTORDF_ONTOLOGY_VALIDATIONPLAN_H
+#define AUTORDF_ONTOLOGY_VALIDATIONPLAN_H
+
+#include <string>
+#include <vector>
+#include <optional>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <autordf/Uri.h>
+#include <autordf/cvt/RdfTypeEnum.h>
+#include <autordf/ontology/autordf-ontology_export.h>
+
+namespace autordf {
+namespace ontology {
+
+class Klass;
+class Ontology;
+
+/**
+ * Flattened list of the checks the validator has to run on an instance of a class.
+ *
+ * Plans are computed once for all when the ontology is loaded: cardinalities, ranges and domains are
+ * resolved for the class and all its ancestors, so that validating an object boils down to a linear
+ * walk on the rules, against properties read back in a single pass.
+ */
+class ValidationPlan {
+public:
+    /**
+     * Checks to run for one property of a class
+     */
+    struct Rule {
+        enum Kind {
+            /** Property values are literals, checked against an xsd datatype */
+            DATA,
+            /** Property values are resources, checked against an ontology class */
+            OBJECT
+        };
+
+        /**
+         * Whether this is an annotation/data property rule or an object property rule
+         */
+        Kind kind;
+
+        /**
+         * Property this rule applies to
+         */
+        Uri predicate;
+
+        /**
+         * Minimum number of values, class restrictions taken into account
+         */
+        unsigned int minCardinality;
+
+        /**
+         * Maximum number of values, class restrictions taken into account
+         */
+        unsigned int maxCardinality;
+
+        /**
+         * Range of the property, class restrictions taken into account
+         */
+        Uri range;
+
+        /**
+         * True if the class owning this rule is listed in the property domains
+         */
+        bool inDomain;
+
+        /**
+         * For DATA rules, datatype values must be convertible to, if range is a known xsd datatype
+         */
+        std::optional<cvt::RdfTypeEnum> dataType;
+
+        /**
+         * For OBJECT rules, indexes of the range class and all of its subclasses, see Klass::index().
+         * Empty if range is not a class of the ontology
+         */
+        boost::dynamic_bitset<> acceptedTypes;
+
+        /**
+         * Returns true if one of the given rdf types is compatible with the range of this rule
+         * @param ontology ontology this rule was built from, to find types class indexes
+         */
+        AUTORDF_ONTOLOGY_EXPORT bool acceptsTypes(const std::vector<Uri>& types, const Ontology& ontology) const;
+    };
+
+    /**
+     * Rules contributed by one class of the hierarchy, as a contiguous range in rules()
+     */
+    struct Segment {
+        /**
+         * Class the rules come from
+         */
+        const Klass* klass;
+
+        /**
+         * Index of the first rule of this class in rules()
+         */
+        size_t begin;
+
+        /**
+         * Index after the last rule of this class in rules()
+         */
+        size_t end;
+    };
+
+    /**
+     * Builds plan for the given class, taking all its ancestors into account
+     */
+    AUTORDF_ONTOLOGY_EXPORT explicit ValidationPlan(const Klass& kls);
+
+    /**
+     * The class this plan was built for
+     */
+    const Klass& klass() const { return *_klass; }
+
+    /**
+     * The class and all its ancestors, sorted by IRI, each with the range of rules it contributes
+     */
+    const std::vector<Segment>& segments() const { return _segments; }
+
+    /**
+     * Rules contributed by the plan class only, not by its ancestors
+     */
+    const Segment& ownSegment() const { return _segments[_ownSegment]; }
+
+    /**
+     * All the rules, class and ancestors ones, in segments() order
+     */
+    const std::vector<Rule>& rules() const { return _rules; }
+
+private:
+    const Klass* _klass;
+    std::vector<Segment> _segments;
+    size_t _ownSegment;
+    std::vector<Rule> _rules;
+
+    void addRules(const Klass& kls);
+};
+
+}
+}
+
+#endif //AUTORDF_ONTOLOGY_VALIDATIONPLAN_H
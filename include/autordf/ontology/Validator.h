@@ -70,6 +70,11 @@ public:
      * store iri
      */
     Uri range;
+
+    /**
+     * For DUPLICATEDVALUESKEY errors, the objects sharing the duplicated value
+     */
+    std::vector<Object> duplicates;
     /**
      * Message,with placeholders replaced with their actual values
      */
@@ -106,6 +111,11 @@ AUTORDF_ONTOLOGY_EXPORT Error::Vec validateModel(const Ontology& ontology,
 AUTORDF_ONTOLOGY_EXPORT Error::Vec validateObject(const Ontology& ontology,
                                                   const Object& object,
                                                   const ValidationOption& option = ValidationOption());
+
+/**
+ * Checks that no two instances of this class share the same value for one of the class keys
+ */
+AUTORDF_ONTOLOGY_EXPORT Error::Vec validateKeys(const Ontology& ontology, const Klass& klass);
 }
 }
 }
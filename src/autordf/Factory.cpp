@@ -9,11 +9,7 @@ namespace autordf {
 Factory::Factory() : Model() {}
 
 Resource Factory::createBlankNodeResource(const std::string &bnodeid) {
-    std::string id = bnodeid;
-    if ( id.empty() ) {
-        id = genBlankNodeId();
-    }
-    Resource r(NodeType::BLANK, id, this);
+    Resource r(NodeType::BLANK, bnodeid.empty() ? genBlankNodeId() : bnodeid, this);
     return r;
 }
 
@@ -8,12 +8,17 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <optional>
+#include <typeinfo>
+#include <unordered_map>
 
 #include "autordf/internal/World.h"
 #include "autordf/internal/ModelPrivate.h"
+#include "autordf/internal/NamespaceIndex.h"
 #include "autordf/internal/Stream.h"
 #include "autordf/internal/StatementConverter.h"
 #include "autordf/Exception.h"
+#include "autordf/notification/NotifierLocker.h"
 #ifdef USE_REDLAND
 #include "autordf/internal/Parser.h"
 #include "autordf/internal/Uri.h"
@@ -38,6 +43,23 @@ void retrieveSeenNamespaces(std::shared_ptr<internal::Parser> parser, Model *mod
     }
 }
 
+/**
+ * Adds parsed statements to graph, except the ones that name their own graph, as in TriG or N-Quads
+ * @return false on failure
+ */
+bool addStreamToGraph(ModelPrivate *model, const Node& graph, librdf_stream *stream) {
+    if ( !stream ) {
+        return false;
+    }
+    for ( ; !librdf_stream_end(stream); librdf_stream_next(stream) ) {
+        librdf_node *context = static_cast<librdf_node*>(librdf_stream_get_context2(stream));
+        if ( librdf_model_context_add_statement(model->get(), context ? context : graph.get(), librdf_stream_get_object(stream)) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::shared_ptr<librdf_serializer> prepareSerializer(const char *format, const std::map<std::string, std::string>& namespacesPrefixes) {
     std::shared_ptr<librdf_serializer> s(librdf_new_serializer(World().get(), format, 0, 0), librdf_free_serializer);
     if ( !s ) {
@@ -55,10 +77,14 @@ std::shared_ptr<librdf_serializer> prepareSerializer(const char *format, const s
     return s;
 }
 
-Model::Model() : _world(new World()), _model(new ModelPrivate(std::make_shared<Storage>())){
+Model::Model() : Model(std::make_shared<Storage>()) {
 }
 
-Model::Model(std::shared_ptr<Storage> storage) : _world(new World()), _model(new ModelPrivate(storage)) {
+Model::Model(bool) : Model() {
+}
+
+Model::Model(std::shared_ptr<Storage> storage) : _world(new World()), _model(new ModelPrivate(storage)), _readOnly(false),
+                 _namespaceIndex(std::make_shared<NamespaceIndex>()), _notifier(std::make_shared<notification::DefaultNotifier>()) {
 }
 
 void Model::loadFromFile(const std::string& path, const std::string& baseIRI) {
@@ -88,6 +114,7 @@ void Model::loadFromMemory(const void* data, const char *format, const std::stri
     if ( !p ) {
         throw UnsupportedRdfFileFormat("File format not recognized");
     }
+    _model->changed();
     if ( librdf_parser_parse_string_into_model(p->get(), static_cast<const unsigned char *>(data), (baseIRI.length() ? Uri(baseIRI).get() : Uri(".").get()), _model->get()) ) {
         throw InternalError("Failed to read model from stream");
     }
@@ -100,6 +127,7 @@ void Model::loadFromFile(FILE *fileHandle, const char *format, const std::string
     if ( !p ) {
         throw UnsupportedRdfFileFormat(streamInfo + ": File format not recognized");
     }
+    _model->changed();
     if ( librdf_parser_parse_file_handle_into_model(p->get(), fileHandle, 0, (baseIRI.length() ? Uri(baseIRI).get() : Uri(".").get()), _model->get()) ) {
         throw InternalError(streamInfo + ": Failed to read model from stream");
     }
@@ -107,6 +135,38 @@ void Model::loadFromFile(FILE *fileHandle, const char *format, const std::string
     retrieveSeenNamespaces(p, this, &_baseUri);
 }
 
+void Model::loadGraphFromFile(const Node& graph, const std::string& path, const std::string& baseIRI) {
+    if ( graph.empty() ) {
+        return loadFromFile(path, baseIRI);
+    }
+    const char *format = librdf_parser_guess_name2(_world->get(), NULL, NULL, reinterpret_cast<const unsigned char *>(path.c_str()));
+    if ( !format ) {
+        throw UnsupportedRdfFileFormat("Unable to deduce format from file save name");
+    }
+    std::shared_ptr<Parser> p = std::make_shared<Parser>(format);
+    _model->changed();
+    std::shared_ptr<librdf_stream> stream(librdf_parser_parse_as_stream(p->get(), Uri("file:" + path).get(), (baseIRI.length() ? Uri(baseIRI).get() : nullptr)), librdf_free_stream);
+    if ( !addStreamToGraph(_model.get(), graph, stream.get()) ) {
+        throw InternalError(path + ": Failed to read model from stream");
+    }
+    _baseUri = baseIRI;
+    retrieveSeenNamespaces(p, this, &_baseUri);
+}
+
+void Model::loadGraphFromMemory(const Node& graph, const void* data, const char *format, const std::string& baseIRI) {
+    if ( graph.empty() ) {
+        return loadFromMemory(data, format, baseIRI);
+    }
+    std::shared_ptr<Parser> p = std::make_shared<Parser>(format);
+    _model->changed();
+    std::shared_ptr<librdf_stream> stream(librdf_parser_parse_string_as_stream(p->get(), static_cast<const unsigned char *>(data), (baseIRI.length() ? Uri(baseIRI).get() : Uri(".").get())), librdf_free_stream);
+    if ( !addStreamToGraph(_model.get(), graph, stream.get()) ) {
+        throw InternalError("Failed to read model from stream");
+    }
+    _baseUri = baseIRI;
+    retrieveSeenNamespaces(p, this, &_baseUri);
+}
+
 void Model::saveToFile(const std::string& path, const std::string& baseIRI, bool enforceRepeatable, const char *format) {
     if ( !format ) {
         format = librdf_parser_guess_name2(_world->get(), NULL, NULL, reinterpret_cast<const unsigned char *>(path.c_str()));
@@ -259,31 +319,129 @@ void Model::add(Statement *stmt) {
         throw ReadOnlyError("Model::add called on read only model");
     }
     std::shared_ptr<librdf_statement> librdfstmt(StatementConverter::toCAPIStatement(stmt));
-    if ( librdf_model_add_statement (_model->get(), librdfstmt.get()) ) {
+    if ( (stmt->graph.empty() ? librdf_model_add_statement(_model->get(), librdfstmt.get()) :
+                                librdf_model_context_add_statement(_model->get(), stmt->graph.get(), librdfstmt.get())) ) {
         std::stringstream ss;
         ss << "Unable to add statement";
         throw InternalError(ss.str());
     }
+    _model->changed();
     if (_notifier) {
         _notifier->added(*stmt);
     }
 }
 
+void Model::add(const std::vector<Statement>& stmts) {
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::add called on read only model");
+    }
+    std::optional<notification::NotifierLocker> locker;
+    if (_notifier) {
+        locker.emplace(*_notifier);
+    }
+    for (Statement stmt : stmts) {
+        std::shared_ptr<librdf_statement> librdfstmt(StatementConverter::toCAPIStatement(&stmt));
+        if ( (stmt.graph.empty() ? librdf_model_add_statement(_model->get(), librdfstmt.get()) :
+                                   librdf_model_context_add_statement(_model->get(), stmt.graph.get(), librdfstmt.get())) ) {
+            std::stringstream ss;
+            ss << "Unable to add statement";
+            throw InternalError(ss.str());
+        }
+        if (_notifier) {
+            _notifier->added(stmt);
+        }
+    }
+    _model->changed();
+}
+
 void Model::remove(Statement *stmt) {
     if ( _readOnly ) {
         throw ReadOnlyError("Model::remove called on read only model");
     }
     std::shared_ptr<librdf_statement> librdfstmt(StatementConverter::toCAPIStatement(stmt));
-    if ( librdf_model_remove_statement (_model->get(), librdfstmt.get()) ) {
+    if ( (stmt->graph.empty() ? librdf_model_remove_statement(_model->get(), librdfstmt.get()) :
+                                librdf_model_context_remove_statement(_model->get(), stmt->graph.get(), librdfstmt.get())) ) {
         std::stringstream ss;
         ss << "Unable to remove statement";
         throw InternalError(ss.str());
     }
+    _model->changed();
     if (_notifier) {
         _notifier->removed(*stmt);
     }
 }
 
+void Model::remove(const std::vector<Statement>& stmts) {
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::remove called on read only model");
+    }
+    std::optional<notification::NotifierLocker> locker;
+    if (_notifier) {
+        locker.emplace(*_notifier);
+    }
+    for (Statement stmt : stmts) {
+        std::shared_ptr<librdf_statement> librdfstmt(StatementConverter::toCAPIStatement(&stmt));
+        int ret = stmt.graph.empty() ? librdf_model_remove_statement(_model->get(), librdfstmt.get()) :
+                                       librdf_model_context_remove_statement(_model->get(), stmt.graph.get(), librdfstmt.get());
+        if ( !ret && _notifier ) {
+            _notifier->removed(stmt);
+        }
+    }
+    _model->changed();
+}
+
+size_t Model::dropGraph(const Node& graph) {
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::dropGraph called on read only model");
+    }
+    if ( graph.empty() || graph.type() == NodeType::LITERAL ) {
+        throw InvalidNodeType("Model::dropGraph called without a graph resource");
+    }
+    Statement query;
+    query.graph = graph;
+    // Redland statement lists are lazy: statements are read before being removed
+    std::vector<Statement> removed;
+    for ( const Statement& stmt : find(query) ) {
+        removed.push_back(stmt);
+    }
+    if ( librdf_model_context_remove_statements(_model->get(), graph.get()) ) {
+        throw InternalError("Unable to remove graph statements");
+    }
+    _model->changed();
+    if (_notifier) {
+        notification::NotifierLocker locker(*_notifier);
+        for ( const Statement& stmt : removed ) {
+            _notifier->removed(stmt);
+        }
+    }
+    return removed.size();
+}
+
+size_t Model::clear(const Node& preservedGraph) {
+    if ( preservedGraph.type() == NodeType::LITERAL ) {
+        throw InvalidNodeType("Model::clear called with a literal as preserved graph");
+    }
+    // Storage may be persistent and shared: statements are removed one by one
+    std::vector<Statement> removed;
+    for ( const Statement& stmt : find() ) {
+        if ( preservedGraph.empty() || !librdf_node_equals(stmt.graph.get(), preservedGraph.get()) ) {
+            removed.push_back(stmt);
+        }
+    }
+    remove(removed);
+    return removed.size();
+}
+
+size_t Model::clear(const Statement& pattern) {
+    // Redland statement lists are lazy: statements are read before being removed
+    std::vector<Statement> removed;
+    for ( const Statement& stmt : find(pattern) ) {
+        removed.push_back(stmt);
+    }
+    remove(removed);
+    return removed.size();
+}
+
 /**
  * Return one arc (predicate) of an arc in an RDF graph given source (subject) and arc (predicate).
  */
@@ -291,17 +449,14 @@ Node Model::findTarget(const Node& source, const Node& arc) const {
     return Node(librdf_model_get_target(_model->get(), source.get(), arc.get()), true);
 }
 
-ANotifier *Model::notifier() const {
-    return _notifier;
-}
+#elif defined(USE_SORD)
 
-void Model::setNotifier(ANotifier *notifier) {
-    _notifier = notifier;
+Model::Model() : _world(new World()), _model(new ModelPrivate()), _readOnly(false),
+                 _namespaceIndex(std::make_shared<NamespaceIndex>()), _notifier(std::make_shared<notification::DefaultNotifier>()) {
 }
 
-#elif defined(USE_SORD)
-
-Model::Model() : _world(new World()), _model(new ModelPrivate()), _readOnly(false), _notifier(std::make_shared<notification::DefaultNotifier>()) {
+Model::Model(bool graphIndexes) : _world(new World()), _model(new ModelPrivate(graphIndexes)), _readOnly(false),
+                 _namespaceIndex(std::make_shared<NamespaceIndex>()), _notifier(std::make_shared<notification::DefaultNotifier>()) {
 }
 
 std::string guessFormat(const std::string& path) {
@@ -313,33 +468,21 @@ std::string guessFormat(const std::string& path) {
         return "turtle";
     } else if ( ext == ".nt" ) {
         return "ntriples";
+    } else if ( ext == ".nq" ) {
+        return "nquads";
+    } else if ( ext == "rig" && path.size() > 5 && path.substr(path.length() - 5) == ".trig" ) {
+        return "trig";
     }
 
     throw UnsupportedRdfFileFormat("Unable to deduce format from file save name");
 }
 
-void Model::loadFromFile(const std::string& path, const std::string& baseIRI) {
-    const std::string format = guessFormat(path);
-    FILE *f = ::fopen(path.c_str(), "r");
-    if ( !f ) {
-        std::stringstream ss;
-        ss << "Unable to open " << path << ": " << ::strerror(errno);
-        throw FileIOError(ss.str().c_str());
-    }
-    try {
-        loadFromFile(f, format.c_str(), baseIRI, path);
-    }
-    catch(...) {
-        ::fclose(f);
-        throw;
-    }
-    ::fclose(f);
-}
-
 SerdSyntax getFormat(const std::string& format, const std::string& streamInfo) {
     std::map<std::string, SerdSyntax> syntax = {
             {"turtle", SERD_TURTLE},
-            {"ntriples", SERD_NTRIPLES}
+            {"ntriples", SERD_NTRIPLES},
+            {"nquads", SERD_NQUADS},
+            {"trig", SERD_TRIG}
     };
     auto found = syntax.find(format);
     if ( found != syntax.end() ) {
@@ -371,36 +514,73 @@ void extractBaseURI(Model *m, std::shared_ptr<SerdEnv> env, const std::string& b
 
 
 static int sordBlankId(SerdReader*, char* buf, size_t buf_size) {
-    return snprintf(
-            buf, buf_size, "%s", World::genUniqueId().c_str());
+    return static_cast<int>(World::genUniqueId(buf, buf_size));
 }
 
-void Model::loadFromMemory(const void* data, const char *format, const std::string& baseIRI) {
+/**
+ * Reader adding statements without a graph to graph, or to the default graph if graph is empty
+ */
+std::shared_ptr<SerdReader> newReader(ModelPrivate *model, SerdEnv *env, SerdSyntax syntax, const Node& graph) {
+    std::shared_ptr<SerdReader> reader = std::shared_ptr<SerdReader>(sord_new_reader(model->get(), env, syntax, graph.get()), &serd_reader_free);
+    serd_reader_set_blank_node_gen(reader.get(), &sordBlankId, World::UNIQUE_ID_MAX_SIZE);
+    model->changed();
+    return reader;
+}
+
+void readFile(Model *m, ModelPrivate *model, FILE *fileHandle, const char *format, const std::string& baseIRI, const std::string& streamInfo, const Node& graph) {
     SerdNode base = serd_node_from_string(SERD_URI, reinterpret_cast<const uint8_t*>(baseIRI.c_str()));
     std::shared_ptr<SerdEnv> env = std::shared_ptr<SerdEnv>(serd_env_new(&base), &serd_env_free);
 
-    SerdSyntax syntax = getFormat(format, "");
+    SerdSyntax syntax = getFormat(format, streamInfo);
 
-    std::shared_ptr<SerdReader> reader = std::shared_ptr<SerdReader>(sord_new_reader(_model->get(), env.get(), syntax, NULL), &serd_reader_free);
-    serd_reader_set_blank_node_gen(reader.get(), &sordBlankId, 50);
-    serd_reader_read_string(reader.get(), reinterpret_cast<const uint8_t*>(data));
+    std::shared_ptr<SerdReader> reader = newReader(model, env.get(), syntax, graph);
+    serd_reader_read_file_handle(reader.get(), fileHandle, reinterpret_cast<const uint8_t *>(streamInfo.c_str()));
 
-    extractBaseURI(this, env, baseIRI);
+    extractBaseURI(m, env, baseIRI);
 }
 
-void Model::loadFromFile(FILE *fileHandle, const char *format, const std::string& baseIRI, const std::string& streamInfo) {
+void Model::loadFromFile(const std::string& path, const std::string& baseIRI) {
+    loadGraphFromFile(Node(), path, baseIRI);
+}
+
+void Model::loadGraphFromFile(const Node& graph, const std::string& path, const std::string& baseIRI) {
+    const std::string format = guessFormat(path);
+    FILE *f = ::fopen(path.c_str(), "r");
+    if ( !f ) {
+        std::stringstream ss;
+        ss << "Unable to open " << path << ": " << ::strerror(errno);
+        throw FileIOError(ss.str().c_str());
+    }
+    try {
+        readFile(this, _model.get(), f, format.c_str(), baseIRI, path, graph);
+    }
+    catch(...) {
+        ::fclose(f);
+        throw;
+    }
+    ::fclose(f);
+}
+
+void Model::loadFromMemory(const void* data, const char *format, const std::string& baseIRI) {
+    loadGraphFromMemory(Node(), data, format, baseIRI);
+}
+
+void Model::loadGraphFromMemory(const Node& graph, const void* data, const char *format, const std::string& baseIRI) {
     SerdNode base = serd_node_from_string(SERD_URI, reinterpret_cast<const uint8_t*>(baseIRI.c_str()));
     std::shared_ptr<SerdEnv> env = std::shared_ptr<SerdEnv>(serd_env_new(&base), &serd_env_free);
 
-    SerdSyntax syntax = getFormat(format, streamInfo);
+    SerdSyntax syntax = getFormat(format, "");
 
-    std::shared_ptr<SerdReader> reader = std::shared_ptr<SerdReader>(sord_new_reader(_model->get(), env.get(), syntax, NULL), &serd_reader_free);
-    serd_reader_set_blank_node_gen(reader.get(), &sordBlankId, 50);
-    serd_reader_read_file_handle(reader.get(), fileHandle, reinterpret_cast<const uint8_t *>(streamInfo.c_str()));
+    std::shared_ptr<SerdReader> reader = newReader(_model.get(), env.get(), syntax, graph);
+    serd_reader_read_string(reader.get(), reinterpret_cast<const uint8_t*>(data));
 
     extractBaseURI(this, env, baseIRI);
 }
 
+void Model::loadFromFile(FILE *fileHandle, const char *format, const std::string& baseIRI, const std::string& streamInfo) {
+    readFile(this, _model.get(), fileHandle, format, baseIRI, streamInfo, Node());
+}
+
 
 void Model::saveToFile(const std::string& path, const std::string& baseIRI, bool enforceRepeatable, std::string format) {
     if ( format.empty() ) {
@@ -477,7 +657,25 @@ std::shared_ptr<std::string> Model::saveToMemory(const char *format, const std::
 }
 
 std::list<std::string> Model::supportedFormat() const {
-    return {"ntriples", "turtle"};
+    return {"ntriples", "turtle", "nquads", "trig"};
+}
+
+/**
+ * sord_contains() takes a missing graph as a wildcard: a statement of a named graph
+ * must not be taken for the same statement in the default graph
+ */
+bool containsQuad(SordModel *model, const SordQuad quad) {
+    if ( quad[SordQuadIndex::SORD_GRAPH] ) {
+        return sord_contains(model, quad);
+    }
+    SordIter* iter = sord_find(model, quad);
+    bool found = false;
+    while ( iter && !sord_iter_end(iter) && !found ) {
+        found = !sord_iter_get_node(iter, SordQuadIndex::SORD_GRAPH);
+        sord_iter_next(iter);
+    }
+    sord_iter_free(iter);
+    return found;
 }
 
 void Model::add(Statement *stmt) {
@@ -486,7 +684,8 @@ void Model::add(Statement *stmt) {
     }
     SordQuad quad;
     StatementConverter::toCAPIStatement(stmt, &quad);
-    if ( !sord_contains(_model->get(), quad) ) {
+    _model->changed();
+    if ( !containsQuad(_model->get(), quad) ) {
         if ( !sord_add(_model->get(), quad) ) {
             std::stringstream ss;
             ss << "Unable to add statement: " << *stmt;
@@ -498,12 +697,38 @@ void Model::add(Statement *stmt) {
     }
 }
 
+void Model::add(const std::vector<Statement>& stmts) {
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::add called on read only model");
+    }
+    std::optional<notification::NotifierLocker> locker;
+    if (_notifier) {
+        locker.emplace(*_notifier);
+    }
+    _model->changed();
+    SordQuad quad;
+    for (const Statement& stmt : stmts) {
+        StatementConverter::toCAPIStatement(&stmt, &quad);
+        if ( !containsQuad(_model->get(), quad) ) {
+            if ( !sord_add(_model->get(), quad) ) {
+                std::stringstream ss;
+                ss << "Unable to add statement: " << stmt;
+                throw InternalError(ss.str());
+            }
+        }
+        if (_notifier) {
+            _notifier->added(stmt);
+        }
+    }
+}
+
 void Model::remove(Statement *stmt) {
     if ( _readOnly ) {
         throw ReadOnlyError("Model::remove called on read only model");
     }
     SordQuad quad;
     StatementConverter::toCAPIStatement(stmt, &quad);
+    _model->changed();
     SordIter* iter = sord_find(_model->get(), quad);
     if ( iter ) {
         sord_erase(_model->get(), iter);
@@ -518,6 +743,112 @@ void Model::remove(Statement *stmt) {
     }
 }
 
+void Model::remove(const std::vector<Statement>& stmts) {
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::remove called on read only model");
+    }
+    std::optional<notification::NotifierLocker> locker;
+    if (_notifier) {
+        locker.emplace(*_notifier);
+    }
+    _model->changed();
+    SordQuad quad;
+    for (const Statement& stmt : stmts) {
+        StatementConverter::toCAPIStatement(&stmt, &quad);
+        SordIter* iter = sord_find(_model->get(), quad);
+        if ( iter ) {
+            sord_erase(_model->get(), iter);
+            sord_iter_free(iter);
+            if (_notifier) {
+                _notifier->removed(stmt);
+            }
+        }
+    }
+}
+
+size_t Model::dropGraph(const Node& graph) {
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::dropGraph called on read only model");
+    }
+    if ( graph.empty() || graph.type() == NodeType::LITERAL ) {
+        throw InvalidNodeType("Model::dropGraph called without a graph resource");
+    }
+    Statement pattern;
+    pattern.graph = graph;
+    return clear(pattern);
+}
+
+size_t Model::clear(const Node& preservedGraph) {
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::clear called on read only model");
+    }
+    if ( preservedGraph.type() == NodeType::LITERAL ) {
+        throw InvalidNodeType("Model::clear called with a literal as preserved graph");
+    }
+    // Statements are not erased one by one from the indexes: the storage is replaced.
+    // Cursors still reading the old storage keep it alive, and fail at their next step
+    std::shared_ptr<ModelPrivate> old = _model;
+    old->changed();
+    _model = std::make_shared<ModelPrivate>(old->graphIndexes());
+
+    size_t kept = 0;
+    SordQuad quad;
+    if ( !preservedGraph.empty() ) {
+        SordIter* iter = sord_search(old->get(), nullptr, nullptr, nullptr, preservedGraph.get());
+        for ( ; iter && !sord_iter_end(iter); sord_iter_next(iter) ) {
+            sord_iter_get(iter, quad);
+            sord_add(_model->get(), quad);
+            ++kept;
+        }
+        sord_iter_free(iter);
+    }
+
+    // The default notifier ignores them: removed statements are only read for other ones.
+    // Exact type is compared, as classes derived from DefaultNotifier may handle them
+    if ( _notifier && typeid(*_notifier) != typeid(notification::DefaultNotifier) ) {
+        notification::NotifierLocker locker(*_notifier);
+        SordIter* iter = sord_begin(old->get());
+        for ( ; iter && !sord_iter_end(iter); sord_iter_next(iter) ) {
+            sord_iter_get(iter, quad);
+            if ( preservedGraph.empty() || !sord_node_equals(quad[SordQuadIndex::SORD_GRAPH], preservedGraph.get()) ) {
+                _notifier->removed(*StatementConverter::fromCAPIStatement(&quad));
+            }
+        }
+        sord_iter_free(iter);
+    }
+    return sord_num_quads(old->get()) - kept;
+}
+
+size_t Model::clear(const Statement& pattern) {
+    if ( pattern.subject.empty() && pattern.predicate.empty() && pattern.object.empty() && pattern.graph.empty() ) {
+        return clear();
+    }
+    if ( _readOnly ) {
+        throw ReadOnlyError("Model::clear called on read only model");
+    }
+    std::optional<notification::NotifierLocker> locker;
+    if (_notifier) {
+        locker.emplace(*_notifier);
+    }
+    // Goes through matching statements only, using the best index for pattern
+    size_t count = 0;
+    SordQuad quad, found;
+    StatementConverter::toCAPIStatement(&pattern, &quad);
+    _model->changed();
+    SordIter* iter = sord_find(_model->get(), quad);
+    while ( iter && !sord_iter_end(iter) ) {
+        if (_notifier) {
+            sord_iter_get(iter, found);
+            _notifier->removed(*StatementConverter::fromCAPIStatement(&found));
+        }
+        // Moves iter to next statement
+        sord_erase(_model->get(), iter);
+        ++count;
+    }
+    sord_iter_free(iter);
+    return count;
+}
+
 /**
  * Return one arc (predicate) of an arc in an RDF graph given source (subject) and arc (predicate).
  */
@@ -535,6 +866,59 @@ StatementList Model::find(const Statement& req) const {
     return StatementList(req, this);
 }
 
+StatementCursor Model::findCursor(const Statement& req) const {
+    return StatementCursor(req, this);
+}
+
+size_t Model::copyFrom(const Model& other, const Statement& pattern, std::map<std::string, std::string> *blankNodeIds) {
+    std::map<std::string, std::string> localBlankNodeIds;
+    if ( !blankNodeIds ) {
+        blankNodeIds = &localBlankNodeIds;
+    }
+    // Remapped nodes of this call, so that a blank node is only built once
+    std::unordered_map<std::string, Node> blankNodes;
+    auto remap = [&](Node *node) {
+        if ( node->type() == NodeType::BLANK ) {
+            auto it = blankNodes.find(node->bNodeId());
+            if ( it == blankNodes.end() ) {
+                auto idIt = blankNodeIds->find(node->bNodeId());
+                if ( idIt == blankNodeIds->end() ) {
+                    idIt = blankNodeIds->emplace(node->bNodeId(), genBlankNodeId()).first;
+                }
+                Node remapped;
+                remapped.setBNodeId(idIt->second);
+                it = blankNodes.emplace(node->bNodeId(), remapped).first;
+            }
+            *node = it->second;
+        }
+    };
+
+    // Both models share the same world: nodes are used as is, without going through their text
+    std::vector<Statement> stmts;
+    StatementCursor cursor = other.findCursor(pattern);
+    Statement stmt;
+    while ( cursor.next(&stmt) ) {
+        remap(&stmt.subject);
+        remap(&stmt.object);
+        stmts.push_back(stmt);
+    }
+    add(stmts);
+
+    for ( const auto& prefix : other._namespacesPrefixes ) {
+        if ( !_namespacesPrefixes.count(prefix.first) ) {
+            addNamespacePrefix(prefix.first, prefix.second);
+        }
+    }
+    return stmts.size();
+}
+
+void Model::mergeFrom(const Model& other) {
+    copyFrom(other);
+    if ( _baseUri.empty() ) {
+        _baseUri = other._baseUri;
+    }
+}
+
 /**
  * Return the sources (subjects) of arc in an RDF graph given arc (predicate) and target (object).
  */
@@ -571,25 +955,29 @@ NodeList Model::arcsOut(const Node& node) const {
 }
 
 const std::string& Model::nsToPrefix(const std::string& ns) const {
-    for ( auto const& p : _namespacesPrefixes) {
-        if ( p.second == ns ) {
-            return p.first;
-        }
+    const std::string *prefix = _namespaceIndex->prefix(ns);
+    if ( !prefix ) {
+        throw std::out_of_range("Namespace " + ns + " not found in Model namespace map");
     }
-    throw std::out_of_range("Namespace " + ns + " not found in Model namespace map");
+    return *prefix;
 }
 
 /**
- * Returns the prefix that matches the given rdfiri if a prefix is registered, empty otherwise
+ * Returns the prefix of the longest registered namespace rdfiri starts with, empty otherwise
  */
 std::string Model::iriPrefix(const std::string& rdfiri) const {
-    for ( const std::pair<const std::string, std::string>& prefixMapItem : _namespacesPrefixes ) {
-        const std::string& iri = prefixMapItem.second;
-        if ( rdfiri.find(iri) == 0 ) {
-            return prefixMapItem.first;
-        }
+    std::string prefix;
+    longestNamespace(rdfiri, &prefix);
+    return prefix;
+}
+
+std::string::size_type Model::longestNamespace(const std::string& iri, std::string *prefix) const {
+    std::string::size_type length;
+    const std::string *match = _namespaceIndex->longestMatch(iri, &length);
+    if ( match && prefix ) {
+        *prefix = *match;
     }
-    return "";
+    return length;
 }
 
 const std::string& Model::prefixToNs(const std::string& prefix) const {
@@ -600,6 +988,7 @@ void Model::addNamespacePrefix(const std::string& prefix, const std::string& ns)
     auto it = _namespacesPrefixes.find(prefix);
     if ( it == _namespacesPrefixes.end() ) {
         _namespacesPrefixes[prefix] = ns;
+        _namespaceIndex->add(prefix, ns);
     } else if ( it->second != ns ) {
         throw InternalError("Unable to add prefix " + prefix + "-->" + ns + " mappping: already registered to " + it->second);
     }
@@ -5,9 +5,21 @@
 #include <autordf/Exception.h>
 
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace autordf {
 
+namespace {
+/**
+ * Identifies a resource node: IRI, or "_:" prefixed blank node id
+ */
+std::string nodeKey(const Node& node) {
+    return node.type() == NodeType::BLANK ? std::string("_:") + node.bNodeId() : std::string(node.iri());
+}
+}
+
 std::stack<Factory *> Object::_factories;
 
 const std::string Object::RDF_NS = "http://www.w3.org/1999/02/22-rdf-syntax-ns#";
@@ -77,8 +89,9 @@ std::string Object::QName() const {
 
 std::vector<Uri> Object::getTypes(const std::string& namespaceFilter) const {
     std::vector<Uri> obj;
-    const std::shared_ptr<std::list<Property>>& propList = _r.getPropertyValues(RDF_TYPE);
-    for (const Property& prop: *propList) {
+    std::vector<Property> propList;
+    _r.getPropertyValues(RDF_TYPE, &propList);
+    for (const Property& prop: propList) {
         autordf::Uri type = prop.asResource().name();
         if (namespaceFilter.empty() || type.find(namespaceFilter) == 0) {
             obj.push_back(type);
@@ -98,7 +111,26 @@ Object Object::getObject(const Uri &propertyIRI) const {
     }
 }
 
+Object Object::getObject(const Predicate& predicate) const {
+    std::optional<Object> obj = getOptionalObject(predicate);
+    if ( obj ) {
+        return *obj;
+    } else {
+        std::stringstream ss;
+        ss << "Property " << predicate << " not found in " << _r.name() << " resource." << std::endl;
+        throw PropertyNotFound(ss.str());
+    }
+}
+
 std::optional<Object> Object::getOptionalObject(const Uri& propertyIRI) const {
+    return getOptionalObjectImpl(propertyIRI);
+}
+
+std::optional<Object> Object::getOptionalObject(const Predicate& predicate) const {
+    return getOptionalObjectImpl(predicate);
+}
+
+template<typename IRI> std::optional<Object> Object::getOptionalObjectImpl(const IRI& propertyIRI) const {
     std::optional<Property> p(_r.getOptionalProperty(propertyIRI));
     if ( p ) {
         return std::make_optional(Object(p->asResource()));
@@ -116,6 +148,10 @@ std::vector<Object> Object::getObjectList(const Uri& propertyIRI, bool preserveO
     return getObjectListImpl<Object>(propertyIRI, preserveOrdering);
 }
 
+std::vector<Object> Object::getObjectList(const Predicate& predicate, bool preserveOrdering) const {
+    return getObjectListImpl<Object>(predicate, preserveOrdering);
+}
+
 void Object::setObject(const Uri& propertyIRI, const Object& obj) {
     notification::NotifierLocker locker(factory()->notifier());
     // First remove all reified statements
@@ -216,7 +252,26 @@ PropertyValue Object::getPropertyValue(const Uri& propertyIRI, Factory *f ) cons
     }
 }
 
+PropertyValue Object::getPropertyValue(const Predicate& predicate, Factory *f ) const {
+    std::optional<PropertyValue> pv = getOptionalPropertyValue(predicate, f);
+    if ( pv ) {
+        return *pv;
+    } else {
+        std::stringstream ss;
+        ss << "Property " << predicate << " not found in " << _r.name() << " resource." << std::endl;
+        throw PropertyNotFound(ss.str());
+    }
+}
+
 std::optional<PropertyValue> Object::getOptionalPropertyValue(const Uri& propertyIRI, autordf::Factory *f ) const {
+    return getOptionalPropertyValueImpl(propertyIRI, f);
+}
+
+std::optional<PropertyValue> Object::getOptionalPropertyValue(const Predicate& predicate, autordf::Factory *f ) const {
+    return getOptionalPropertyValueImpl(predicate, f);
+}
+
+template<typename IRI> std::optional<PropertyValue> Object::getOptionalPropertyValueImpl(const IRI& propertyIRI, autordf::Factory *f ) const {
 
     if (nullptr == f) {
         f = factory();
@@ -243,6 +298,14 @@ std::vector<PropertyValue> Object::getPropertyValueList(const Uri& propertyIRI,
     return valuesList;
 }
 
+std::vector<PropertyValue> Object::getPropertyValueList(const Predicate& predicate, bool preserveOrdering) const {
+    std::vector<PropertyValue> valuesList;
+    propertyIterate(predicate, preserveOrdering, [&valuesList](const Property& prop) {
+        valuesList.emplace_back(prop.value());
+    });
+    return valuesList;
+}
+
 void Object::setPropertyValue(const Uri& propertyIRI, const PropertyValue& val) {
     notification::NotifierLocker locker(factory()->notifier());
     // First remove all reified statements
@@ -467,8 +530,9 @@ void Object::ensureUnreificationIsPossible(const std::shared_ptr<Resource>& alre
     static const std::set<std::string> RDF_REIFICATION_STATEMENTS = {
             RDF_TYPE, RDF_SUBJECT, RDF_PREDICATE, RDF_OBJECT, AUTORDF_ORDER
     };
-    const std::shared_ptr<std::list<Property>>& propList = alreadyReified->getPropertyValues();
-    for ( const Property& prop : *propList ) {
+    std::vector<Property> propList;
+    alreadyReified->getPropertyValues(&propList);
+    for ( const Property& prop : propList ) {
         if ( !RDF_REIFICATION_STATEMENTS.count(prop.iri()) ) {
             std::stringstream ss;
             ss << "Reified statement contains user defined property " << prop;
@@ -667,13 +731,22 @@ void Object::setPropertyValueList(const Uri& propertyIRI, const std::vector<Prop
 }
 
 void Object::propertyIterate(const Uri& propertyIRI, bool preserveOrdering, std::function<void (const Property& prop)> cb) const {
-    notification::NotifierLocker locker(factory()->notifier());
     if ( propertyIRI.empty() ) {
         throw InvalidIRI("Calling propertyIterate() with empty IRI is forbidden");
     }
-    const std::shared_ptr<std::list<Property>>& propList = _r.getPropertyValues(propertyIRI);
+    propertyIterateImpl(propertyIRI, preserveOrdering, cb);
+}
+
+void Object::propertyIterate(const Predicate& predicate, bool preserveOrdering, std::function<void (const Property& prop)> cb) const {
+    propertyIterateImpl(predicate, preserveOrdering, cb);
+}
+
+template<typename IRI> void Object::propertyIterateImpl(const IRI& propertyIRI, bool preserveOrdering, const std::function<void (const Property& prop)>& cb) const {
+    notification::NotifierLocker locker(factory()->notifier());
+    std::vector<Property> propList;
+    _r.getPropertyValues(propertyIRI, &propList);
     unsigned int count = 0;
-    for (const Property& prop: *propList) {
+    for (const Property& prop: propList) {
         cb(prop);
         ++count;
     }
@@ -705,6 +778,71 @@ void Object::propertyIterate(const Uri& propertyIRI, bool preserveOrdering, std:
     }
 }
 
+std::map<Uri, std::vector<Node>> Object::getAllPropertyNodes() const {
+    notification::NotifierLocker locker(factory()->notifier());
+    std::map<Uri, std::vector<Node>> values;
+
+    Statement request;
+    request.subject = currentNode();
+    for (const Statement& stmt: factory()->find(request)) {
+        values[stmt.predicate.iri()].push_back(stmt.object);
+    }
+
+    for (const Node& reified: reificationResourcesForCurrentObject()) {
+        Statement reifiedRequest;
+        reifiedRequest.subject = reified;
+        const StatementList& reifiedStatements = factory()->find(reifiedRequest);
+        const Node* predicate = nullptr;
+        const Node* object = nullptr;
+        for (const Statement& stmt: reifiedStatements) {
+            if (RDF_PREDICATE == stmt.predicate.iri()) {
+                predicate = &stmt.object;
+            } else if (RDF_OBJECT == stmt.predicate.iri()) {
+                object = &stmt.object;
+            }
+        }
+        if (predicate && object) {
+            values[predicate->iri()].push_back(*object);
+        }
+    }
+    return values;
+}
+
+PropertySnapshot Object::snapshot() const {
+    notification::NotifierLocker locker(factory()->notifier());
+    PropertySnapshot snapshot(_r.name());
+
+    std::vector<Property> props;
+    _r.getPropertyValues(&props);
+    for (Property& prop: props) {
+        snapshot.addUnreified(std::move(prop));
+    }
+
+    for (const Node& reified: reificationResourcesForCurrentObject()) {
+        props.clear();
+        factory()->createResourceFromNode(reified).getPropertyValues(&props);
+        const Property* predicate = nullptr;
+        const Property* object = nullptr;
+        std::optional<long long> order;
+        for (const Property& prop: props) {
+            if (RDF_PREDICATE == prop.iri()) {
+                predicate = &prop;
+            } else if (RDF_OBJECT == prop.iri()) {
+                object = &prop;
+            } else if (AUTORDF_ORDER == prop.iri()) {
+                order = prop.value().get<cvt::RdfTypeEnum::xsd_integer, long long>();
+            }
+        }
+        if (predicate && object) {
+            std::shared_ptr<Property> prop = factory()->createProperty(predicate->value(), object->type());
+            prop->setValue(object->value(), false);
+            snapshot.addReified(std::move(*prop), order);
+        }
+    }
+    snapshot.complete();
+    return snapshot;
+}
+
 bool Object::isA(const Uri& typeIRI) const {
     return _r.isA(typeIRI);
 }
@@ -713,36 +851,94 @@ void Object::remove(bool bRecursive /*= false*/) {
     notification::NotifierLocker locker(factory()->notifier());
 
     if(bRecursive){
-        if (isA(RDF_STATEMENT)) {
-            std::shared_ptr<Property> object = _r.getProperty(RDF_OBJECT);
-            if(NodeType::BLANK == object->type()){
-                Object(object->asResource()).remove(bRecursive);
+        // Mark first, then sweep: marked nodes are this object, and the blank nodes it leads to that are only
+        // referenced by marked nodes. Marking is iterative so that deep blank node trees do not overflow the stack
+        Factory *f = factory();
+        Node rdfSubject;
+        rdfSubject.setIri(RDF_SUBJECT);
+        std::unordered_set<std::string> marked{nodeKey(currentNode())};
+        std::vector<Node> pending{currentNode()};
+        std::vector<Statement> removed;
+
+        auto mark = [&](const Node& node) {
+            if ( marked.insert(nodeKey(node)).second ) {
+                pending.push_back(node);
             }
-        } else {
-            const NodeList nodesReferingToThisObject = reificationResourcesForCurrentObject();
-            for (const Node& thisObject : nodesReferingToThisObject ) {
-                Resource reifiedStatement(factory()->createResourceFromNode(thisObject));
-                std::shared_ptr<Property> rdfObj = reifiedStatement.getProperty(RDF_OBJECT);
-                if ( rdfObj->type() == NodeType::BLANK) {
-                    Object(rdfObj->asResource()).remove(bRecursive);
+        };
+
+        // Same sources as findSources(): a reified statement stands for its subject
+        auto onlyMarkedSources = [&](const Node& node) {
+            Statement query;
+            query.object = node;
+            for (const Statement& stmt : f->find(query)) {
+                Node subject = f->findTarget(stmt.subject, rdfSubject);
+                if ( subject.empty() ) {
+                    subject = stmt.subject;
+                } else if ( nodeKey(subject) == nodeKey(node) ) {
+                    continue;
+                }
+                if ( !marked.count(nodeKey(subject)) ) {
+                    return false;
                 }
-                Object(reifiedStatement).remove();
             }
+            return true;
+        };
+
+        // Queues node statements for removal, returns its blank rdf:object, or an empty node if it has none
+        auto collect = [&](const Node& node, bool *isStatement, std::vector<Node> *blankObjects) {
+            Node statementObject;
             Statement query;
-            query.subject = currentNode();
-            const StatementList &statements = factory()->find(query);
-            for (const Statement &stmt: statements) {
-                if (stmt.object.type() == NodeType::BLANK) {
-                    Object subobj(factory()->createResourceFromNode(stmt.object));
-                    if (subobj.findSources().size() == 1) {
-                        subobj.remove(bRecursive);
+            query.subject = node;
+            for (const Statement& stmt : f->find(query)) {
+                removed.push_back(stmt);
+                if ( stmt.object.type() == NodeType::BLANK ) {
+                    if ( RDF_OBJECT == stmt.predicate.iri() ) {
+                        statementObject = stmt.object;
+                    }
+                    if ( blankObjects ) {
+                        blankObjects->push_back(stmt.object);
                     }
+                } else if ( isStatement && stmt.object.type() == NodeType::RESOURCE &&
+                            RDF_TYPE == stmt.predicate.iri() && RDF_STATEMENT == stmt.object.iri() ) {
+                    *isStatement = true;
+                }
+            }
+            return statementObject;
+        };
+
+        while ( !pending.empty() ) {
+            Node node = pending.back();
+            pending.pop_back();
+            bool isStatement = false;
+            std::vector<Node> blankObjects;
+            Node statementObject = collect(node, &isStatement, &blankObjects);
+            if ( isStatement ) {
+                if ( !statementObject.empty() ) {
+                    mark(statementObject);
+                }
+                continue;
+            }
+            // Reified statements about node go along with it, along with their blank object
+            for (const Node& reified : f->findSources(rdfSubject, node)) {
+                if ( marked.insert(nodeKey(reified)).second ) {
+                    Node reifiedObject = collect(reified, nullptr, nullptr);
+                    if ( !reifiedObject.empty() ) {
+                        mark(reifiedObject);
+                    }
+                }
+            }
+            for (const Node& blankObject : blankObjects) {
+                if ( !marked.count(nodeKey(blankObject)) && onlyMarkedSources(blankObject) ) {
+                    mark(blankObject);
                 }
             }
         }
+
+        f->remove(removed);
+    } else {
+        _r.removeProperties("");
     }
 
-    _r.removeProperties("");
     if ( !_rdfTypeIRI.empty() ) {
         _rdfTypeWritingRequired = true;
     }
@@ -873,10 +1069,11 @@ std::ostream& Object::printStream(std::ostream& os, int recurse, unsigned int in
     os << "\"Subject\": \"" << _r.name() <<'"';
     std::set<std::string> donePropsIRI;
     // Get all props
-    const std::shared_ptr<std::list<Property>>& propsList = _r.getPropertyValues();
-    for ( auto propit = propsList->begin(); propit != propsList->end(); ++propit ) {
+    std::vector<Property> propsList;
+    _r.getPropertyValues(&propsList);
+    for ( auto propit = propsList.begin(); propit != propsList.end(); ++propit ) {
         if ( !donePropsIRI.count(propit->iri()) ) {
-            if ( propit != propsList->begin() ) {
+            if ( propit != propsList.begin() ) {
                 os << ',';
             }
             newLine(os, indentLevel);
@@ -998,7 +1195,114 @@ Object Object::createFromNode(const Node& node) {
 //TODO : add a version that also clone ressources
 Object Object::cloneRecursiveStopAtResources(const Uri& newIri, bool(*doNotClone)(const Object &, const std::string &, const Object *)) const {
     notification::NotifierLocker locker(factory()->notifier());
-    return cloneRecursiveStopAtResourcesInternal(newIri, doNotClone, true);
+    Object res(newIri, this->_rdfTypeIRI);
+    cloneGraph(doNotClone, res);
+    return res;
+}
+
+void Object::cloneGraph(bool(*doNotClone)(const Object &, const std::string &, const Object *), Object& to) const {
+    Factory *f = factory();
+    Node rdfSubject;
+    rdfSubject.setIri(RDF_SUBJECT);
+    Node rdfType;
+    rdfType.setIri(RDF_TYPE);
+    Node rdfStatement;
+    rdfStatement.setIri(RDF_STATEMENT);
+
+    // A node to copy the statements of. Reified statements copies get reifiedSubject as subject
+    struct Job {
+        Node from;
+        Node to;
+        bool copyProperties;
+        bool copyReified;
+        Node reifiedSubject;
+    };
+    std::vector<Job> pending{{currentNode(), to.currentNode(), !(doNotClone && doNotClone(*this, "", nullptr)), true, Node()}};
+    // Blank nodes clones, by source blank node id: a blank node reached several times is cloned once
+    std::unordered_map<std::string, Node> clones;
+    std::vector<Statement> added;
+    bool toHasProperties = false;
+    bool root = true;
+
+    auto newBlankNode = [f]() {
+        Node node;
+        node.setBNodeId(f->createBlankNodeResource().name());
+        return node;
+    };
+    auto cloneOf = [&](const Node& blank) {
+        auto it = clones.find(blank.bNodeId());
+        if ( it == clones.end() ) {
+            it = clones.emplace(blank.bNodeId(), newBlankNode()).first;
+            pending.push_back({blank, it->second, true, true, Node()});
+        }
+        return it->second;
+    };
+
+    while ( !pending.empty() ) {
+        Job job = std::move(pending.back());
+        pending.pop_back();
+        bool reified = !job.reifiedSubject.empty();
+        // Only built when doNotClone needs it
+        std::optional<Object> parent;
+        auto parentObject = [&]() {
+            if ( !parent ) {
+                parent = Object(f->createResourceFromNode(job.from));
+            }
+            return &*parent;
+        };
+
+        if ( job.copyProperties ) {
+            Statement query;
+            query.subject = job.from;
+            for (const Statement& stmt : f->find(query)) {
+                const char *predicate = stmt.predicate.iri();
+                if ( RDF_SUBJECT == predicate || RDF_PREDICATE == predicate || RDF_OBJECT == predicate ) {
+                    // Only meaningful for reified statements, where subject is the copy and a blank object is always cloned
+                    if ( reified ) {
+                        if ( RDF_SUBJECT == predicate ) {
+                            added.emplace_back(job.to, stmt.predicate, job.reifiedSubject);
+                        } else if ( stmt.object.type() == NodeType::BLANK ) {
+                            added.emplace_back(job.to, stmt.predicate, cloneOf(stmt.object));
+                        } else {
+                            added.emplace_back(job.to, stmt.predicate, stmt.object);
+                        }
+                    }
+                    continue;
+                }
+                if ( reified && RDF_TYPE == predicate && stmt.object.type() == NodeType::RESOURCE && RDF_STATEMENT == stmt.object.iri() ) {
+                    continue;
+                }
+                if ( stmt.object.type() == NodeType::BLANK ) {
+                    if ( doNotClone && doNotClone(f->createResourceFromNode(stmt.object), predicate, parentObject()) ) {
+                        continue;
+                    }
+                    added.emplace_back(job.to, stmt.predicate, cloneOf(stmt.object));
+                } else {
+                    // Make only shallow copy of ressources
+                    added.emplace_back(job.to, stmt.predicate, stmt.object);
+                }
+                toHasProperties = toHasProperties || root;
+            }
+        }
+        if ( reified ) {
+            added.emplace_back(job.to, rdfType, rdfStatement);
+        }
+        root = false;
+
+        if ( job.copyReified ) {
+            for (const Node& reifiedNode : f->findSources(rdfSubject, job.from)) {
+                if ( doNotClone && doNotClone(f->createResourceFromNode(reifiedNode), RDF_PREDICATE, parentObject()) ) {
+                    continue;
+                }
+                pending.push_back({reifiedNode, newBlankNode(), true, false, job.to});
+            }
+        }
+    }
+
+    if ( toHasProperties ) {
+        to.writeRdfType();
+    }
+    f->add(added);
 }
 
 Object Object::cloneRecursiveStopAtResourcesInternal(const Uri& newIri, bool(*doNotClone)(const Object &, const std::string &, const Object *), bool first) const {
@@ -1044,10 +1348,11 @@ void Object::copyPropertiesInternal(bool(*doNotClone)(const Object &, const std:
     if (first && doNotClone && doNotClone(_r, "", nullptr)) {
         return;
     }
-    std::shared_ptr<std::list<Property>> properties = _r.getPropertyValues();
+    std::vector<Property> properties;
+    _r.getPropertyValues(&properties);
     // All of these are handled specially - do not copy
     static const std::vector<std::string> forbiddenProperties({RDF_OBJECT, RDF_SUBJECT, RDF_PREDICATE});
-    for (const Property& property : *properties) {
+    for (const Property& property : properties) {
         if (std::find(forbiddenProperties.begin(), forbiddenProperties.end(), property.iri()) != forbiddenProperties.end()) {
             continue;
         }
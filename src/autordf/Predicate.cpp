@@ -0,0 +1,18 @@
+#include "autordf/internal/cAPI.h"
+#include "autordf/Predicate.h"
+
+#include "autordf/Exception.h"
+#include "autordf/Property.h"
+#include "autordf/internal/World.h"
+
+namespace autordf {
+
+Predicate::Predicate(const std::string& iri) : Uri(iri), _world(new internal::World()) {
+    if ( iri.empty() ) {
+        throw InvalidIRI("Unable to build a Predicate from an empty IRI");
+    }
+    _node.setIri(iri);
+    _sharedIri = std::make_shared<const std::string>(iri);
+}
+
+}
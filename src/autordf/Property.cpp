@@ -8,6 +8,11 @@
 
 namespace autordf {
 
+const std::shared_ptr<const std::string>& Property::emptyIri() {
+    static const std::shared_ptr<const std::string> empty = std::make_shared<const std::string>();
+    return empty;
+}
+
 void Property::setType(NodeType t) {
     _type  = t;
 }
@@ -18,7 +23,7 @@ Resource Property::asResource() const {
     } else if ( _type == NodeType::BLANK ) {
         return _factory->createBlankNodeResource(_value);
     } else {
-        throw InvalidNodeType("Unable to convert Property " + _iri + " as resource");
+        throw InvalidNodeType("Unable to convert Property " + *_iri + " as resource");
     }
 }
 
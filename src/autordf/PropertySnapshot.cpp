@@ -0,0 +1,76 @@
+#include "autordf/PropertySnapshot.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "autordf/Exception.h"
+
+namespace autordf {
+
+const std::vector<Property>& PropertySnapshot::values(const Predicate& predicate, bool preserveOrdering) const {
+    static const std::vector<Property> NO_VALUES;
+    auto it = _values.find(predicate);
+    if ( it == _values.end() ) {
+        return NO_VALUES;
+    }
+    if ( preserveOrdering ) {
+        if ( it->second.unreifiedCount ) {
+            throw CannotPreserveOrder("Unable to read back statements order as there is at least one unreified statement without ordering info");
+        }
+        if ( it->second.missingOrder ) {
+            throw CannotPreserveOrder("Unable to read back statements order as there is at least one reified statement missing ordering info");
+        }
+    }
+    return it->second.properties;
+}
+
+const Property* PropertySnapshot::optionalValue(const Predicate& predicate) const {
+    const std::vector<Property>& props = values(predicate, false);
+    return props.empty() ? nullptr : &props.front();
+}
+
+const Property& PropertySnapshot::value(const Predicate& predicate) const {
+    const Property *prop = optionalValue(predicate);
+    if ( !prop ) {
+        std::stringstream ss;
+        ss << "Property " << predicate << " not found in " << _subject << " resource." << std::endl;
+        throw PropertyNotFound(ss.str());
+    }
+    return *prop;
+}
+
+std::vector<PropertyValue> PropertySnapshot::valueList(const Predicate& predicate, bool preserveOrdering) const {
+    std::vector<PropertyValue> valuesList;
+    for ( const Property& prop : values(predicate, preserveOrdering) ) {
+        valuesList.emplace_back(prop.value());
+    }
+    return valuesList;
+}
+
+void PropertySnapshot::addUnreified(Property&& prop) {
+    Values& values = _values[prop.iri()];
+    values.properties.emplace_back(std::move(prop));
+    ++values.unreifiedCount;
+}
+
+void PropertySnapshot::addReified(Property&& prop, std::optional<long long> order) {
+    Values& values = _values[prop.iri()];
+    values.missingOrder = values.missingOrder || !order;
+    values.reified.emplace_back(order, std::move(prop));
+}
+
+void PropertySnapshot::complete() {
+    for ( auto& item : _values ) {
+        Values& values = item.second;
+        std::stable_sort(values.reified.begin(), values.reified.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+        for ( auto& reified : values.reified ) {
+            values.properties.emplace_back(std::move(reified.second));
+        }
+        values.reified.clear();
+        values.reified.shrink_to_fit();
+    }
+}
+
+}
@@ -1,26 +1,58 @@
 #include <autordf/PropertyValue.h>
+
 #include <autordf/cvt/RdfTypeEnum.h>
 #include <autordf/I18String.h>
 
+#include <unordered_map>
+
 namespace autordf {
 
+std::shared_ptr<const PropertyValue::DataType> PropertyValue::shareDataType(std::string_view dataTypeIri) {
+    // Not filled from cvt::rdfMapType, which may not be initialized yet when a static PropertyValue is built
+    static const std::unordered_map<std::string_view, std::shared_ptr<const DataType>> KNOWN_TYPES = [] {
+        std::unordered_map<std::string_view, std::shared_ptr<const DataType>> types;
+#define X(type, shortName, nameSpace) types.emplace(nameSpace shortName, std::make_shared<const DataType>(nameSpace shortName, cvt::RdfTypeEnum::type));
+        CVT_TYPES_DEF(X)
+#undef X
+        return types;
+    }();
+    if ( dataTypeIri.empty() ) {
+        return nullptr;
+    }
+    auto known = KNOWN_TYPES.find(dataTypeIri);
+    if ( known != KNOWN_TYPES.end() ) {
+        return known->second;
+    }
+    return std::make_shared<const DataType>(std::string(dataTypeIri), std::nullopt);
+}
+
+std::shared_ptr<const std::string> PropertyValue::shareLang(std::string_view lang) {
+    return lang.empty() ? nullptr : std::make_shared<const std::string>(lang);
+}
+
 PropertyValue::PropertyValue(const autordf::I18String& value)
-        : std::string(value), _lang(value.lang()) {}
+        : std::string(value), _lang(shareLang(value.lang())) {}
 
 const std::string& PropertyValue::dataTypeIri() const {
-    return _dataTypeIri;
+    static const std::string NONE;
+    return _dataType ? _dataType->first : NONE;
+}
+
+std::optional<cvt::RdfTypeEnum> PropertyValue::rdfType() const {
+    return _dataType ? _dataType->second : std::nullopt;
 }
 
 const std::string& PropertyValue::lang() const {
-    return _lang;
+    static const std::string NONE;
+    return _lang ? *_lang : NONE;
 }
 
 void PropertyValue::setDataTypeIri(const std::string& dataTypeIri) {
-    _dataTypeIri = dataTypeIri;
+    _dataType = shareDataType(dataTypeIri);
 }
 
 void PropertyValue::setLang(const std::string& lang) {
-    _lang = lang;
+    _lang = shareLang(lang);
 }
 
 std::ostream& PropertyValue::printStream(std::ostream& os) {
@@ -35,9 +67,9 @@ std::ostream& PropertyValue::printStream(std::ostream& os) {
 }
 
 bool PropertyValue::operator==(const PropertyValue& s) const {
-    bool lexicalFormEquality = std::string(*this) == std::string(s);
-    bool dataTypeEquality = explicitDataType() == s.explicitDataType();
-    bool langTagEquality = _lang == s.lang();
+    bool lexicalFormEquality = static_cast<const std::string&>(*this) == static_cast<const std::string&>(s);
+    bool dataTypeEquality = explicitDataTypeIri() == s.explicitDataTypeIri();
+    bool langTagEquality = lang() == s.lang();
     return lexicalFormEquality && dataTypeEquality && langTagEquality;
 }
 
@@ -46,7 +78,7 @@ bool PropertyValue::operator!=(const PropertyValue& val) const  {
 }
 
 bool PropertyValue::operator==(const std::string& s) const {
-    return std::string(*this) == s;
+    return static_cast<const std::string&>(*this) == s;
 }
 
 bool PropertyValue::operator!=(const std::string& s) const {
@@ -54,20 +86,22 @@ bool PropertyValue::operator!=(const std::string& s) const {
 }
 
 bool PropertyValue::operator==(const char *s) const {
-    return std::string(*this) == s;
+    return static_cast<const std::string&>(*this) == s;
 }
 
 bool PropertyValue::operator!=(const char *s) const {
     return !(*this == s);
 }
 
-std::string PropertyValue::explicitDataType() const {
-    if (!_dataTypeIri.empty()) {
-        return _dataTypeIri;
+const std::string& PropertyValue::explicitDataTypeIri() const {
+    static const std::string XSD_STRING = cvt::rdfTypeIri(cvt::RdfTypeEnum::xsd_string);
+    static const std::string RDF_LANGSTRING = cvt::rdfTypeIri(cvt::RdfTypeEnum::rdf_langString);
+    if (_dataType) {
+        return _dataType->first;
     }
-    if (_lang.empty()) {
-        return cvt::rdfTypeIri(cvt::RdfTypeEnum::xsd_string);
+    if (!_lang) {
+        return XSD_STRING;
     }
-    return cvt::rdfTypeIri(cvt::RdfTypeEnum::rdf_langString);
+    return RDF_LANGSTRING;
 }
 }
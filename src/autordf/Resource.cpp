@@ -3,6 +3,8 @@
 #include <stdexcept>
 #include <sstream>
 #include <set>
+#include <string_view>
+#include <unordered_map>
 
 #include <autordf/Resource.h>
 #include <autordf/Factory.h>
@@ -50,35 +52,35 @@ bool Resource::hasProperty(const Property& p) const {
  * @throws If not found, returns null
  */
 std::optional<Property> Resource::getOptionalProperty(const Uri& iri, Factory *f) const {
-    Node subject, predicate;
-
-    if(nullptr == f) {
-        f = _factory;
-    }
-
-    if ( type() == NodeType::RESOURCE ) {
-        subject.setIri(name());
-    } else {
-        subject.setBNodeId(name());
-    }
-
     if ( iri.empty() ) {
         throw InternalError("Not supported");
     }
+    Node predicate;
     predicate.setIri(iri);
+    return getOptionalProperty(predicate, std::make_shared<const std::string>(iri), f);
+}
 
-    Node object = f->findTarget(subject, predicate);
+std::optional<Property> Resource::getOptionalProperty(const Predicate& predicate, Factory *f) const {
+    return getOptionalProperty(predicate.node(), predicate._sharedIri, f);
+}
+
+std::optional<Property> Resource::getOptionalProperty(const Node& predicate, const std::shared_ptr<const std::string>& iri, Factory *f) const {
+    if(nullptr == f) {
+        f = _factory;
+    }
+
+    Node object = f->findTarget(subjectNode(), predicate);
     if ( object.empty() ) {
         return std::nullopt;
     }
 
-    std::optional<Property> p(*f->createProperty(predicate.iri(), object.type()));
+    std::optional<Property> p(Property(object.type(), iri, f));
     if (object.type() == NodeType::LITERAL) {
-        p->setValue(PropertyValue(object.literal(), object.lang(), object.dataType()), false);
+        p->_value = PropertyValue(object.literal(), object.lang(), object.dataType());
     } else if (object.type() == NodeType::RESOURCE) {
-        p->setValue(object.iri(), false);
+        p->_value.assign(object.iri());
     } else if (object.type() == NodeType::BLANK) {
-        p->setValue(object.bNodeId(), false);
+        p->_value.assign(object.bNodeId());
     }
     return p;
 }
@@ -102,38 +104,40 @@ std::shared_ptr<Property> Resource::getProperty(const Uri& iri) const {
  * Lists all values for property matching iri name
  */
 std::shared_ptr<std::list<Property>> Resource::getPropertyValues(const Uri& iri) const {
-    Node subject, predicate;
-    if ( type() == NodeType::RESOURCE ) {
-        subject.setIri(name());
-    } else {
-        subject.setBNodeId(name());
-    }
+    std::vector<Property> values;
+    getPropertyValues(iri, &values);
+    return std::make_shared<std::list<Property>>(std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+}
+
+/**
+ * Lists all values for all properties
+ */
+std::shared_ptr<std::list<Property>> Resource::getPropertyValues() const {
+    std::vector<Property> values;
+    getPropertyValues(&values);
+    return std::make_shared<std::list<Property>>(std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+}
 
+void Resource::getPropertyValues(const Uri& iri, std::vector<Property> *values) const {
     if ( iri.empty() ) {
         throw InternalError("getPropertyValues(const Uri& iri): iri cannot be empty");
     }
+    Node predicate;
     predicate.setIri(iri);
+    getPropertyValues(predicate, std::make_shared<const std::string>(iri), values);
+}
 
-    NodeList foundTriples = _factory->findTargets(subject, predicate);
-    auto resp = std::make_shared<std::list<Property>>();
-    for (const Node& object: foundTriples) {
-        std::shared_ptr<Property> p = _factory->createProperty(predicate.iri(), object.type());
-        if ( object.type() == NodeType::LITERAL) {
-            p->setValue(PropertyValue(object.literal(), object.lang(), object.dataType()), false);
-        } else if ( object.type() == NodeType::RESOURCE) {
-            p->setValue(object.iri(), false);
-        } else if ( object.type() == NodeType::BLANK) {
-            p->setValue(object.bNodeId(), false);
-        }
-        resp->push_back(*p);
+void Resource::getPropertyValues(const Predicate& predicate, std::vector<Property> *values) const {
+    getPropertyValues(predicate.node(), predicate._sharedIri, values);
+}
+
+void Resource::getPropertyValues(const Node& predicate, const std::shared_ptr<const std::string>& iri, std::vector<Property> *values) const {
+    for (const Node& object: _factory->findTargets(subjectNode(), predicate)) {
+        appendProperty(iri, object, values);
     }
-    return resp;
 }
 
-/**
- * Lists all values for all properties
- */
-std::shared_ptr<std::list<Property>> Resource::getPropertyValues() const {
+void Resource::getPropertyValues(std::vector<Property> *values) const {
     Statement request;
     if ( type() == NodeType::RESOURCE ) {
         request.subject.setIri(name());
@@ -141,23 +145,37 @@ std::shared_ptr<std::list<Property>> Resource::getPropertyValues() const {
         request.subject.setBNodeId(name());
     }
 
-    StatementList foundTriples = _factory->find(request);
-
-    auto resp = std::make_shared<std::list<Property>>();
-    for (const Statement& triple: foundTriples) {
-        const Node& object = triple.object;
-        const Node& predicate = triple.predicate;
-        std::shared_ptr<Property> p = _factory->createProperty(predicate.iri(), object.type());
-        if ( object.type() == NodeType::LITERAL) {
-            p->setValue(PropertyValue(object.literal(), object.lang(), object.dataType()), false);
-        } else if ( object.type() == NodeType::RESOURCE) {
-            p->setValue(object.iri(), false);
-        } else if ( object.type() == NodeType::BLANK) {
-            p->setValue(object.bNodeId(), false);
+    // One IRI copy per predicate, shared by all of its values
+    std::unordered_map<std::string_view, std::shared_ptr<const std::string>> iris;
+    for (const Statement& triple: _factory->find(request)) {
+        std::shared_ptr<const std::string>& iri = iris[triple.predicate.iri()];
+        if ( !iri ) {
+            iri = std::make_shared<const std::string>(triple.predicate.iri());
         }
-        resp->push_back(*p);
+        appendProperty(iri, triple.object, values);
+    }
+}
+
+void Resource::appendProperty(const std::shared_ptr<const std::string>& iri, const Node& object, std::vector<Property> *values) const {
+    // Value is built in place: no intermediate Property or PropertyValue copies
+    Property& p = values->emplace_back(Property(object.type(), iri, _factory));
+    if ( object.type() == NodeType::LITERAL) {
+        p._value = PropertyValue(object.literal(), object.lang(), object.dataType());
+    } else if ( object.type() == NodeType::RESOURCE) {
+        p._value.assign(object.iri());
+    } else if ( object.type() == NodeType::BLANK) {
+        p._value.assign(object.bNodeId());
     }
-    return resp;
+}
+
+Node Resource::subjectNode() const {
+    Node subject;
+    if ( type() == NodeType::RESOURCE ) {
+        subject.setIri(name());
+    } else {
+        subject.setBNodeId(name());
+    }
+    return subject;
 }
 
 void Resource::propertyAsNode(const Property& p, Node *n) {
@@ -219,10 +237,7 @@ Resource& Resource::removeProperties(const Uri &iri) {
         request.predicate.setIri(iri);
     }
     StatementList foundTriples = _factory->find(request);
-
-    for (Statement& triple: foundTriples) {
-        _factory->remove(&triple);
-    }
+    _factory->remove(std::vector<Statement>(foundTriples.begin(), foundTriples.end()));
     return *this;
 }
 
@@ -240,8 +255,9 @@ Resource& Resource::setProperties(const std::shared_ptr<std::list<Property>>& li
 }
 
 bool Resource::isA(const Uri& typeIRI) const {
-    const std::shared_ptr<std::list<Property>>& propList = getPropertyValues("http://www.w3.org/1999/02/22-rdf-syntax-ns#type");
-    for (const Property& prop: *propList) {
+    std::vector<Property> propList;
+    getPropertyValues("http://www.w3.org/1999/02/22-rdf-syntax-ns#type", &propList);
+    for (const Property& prop: propList) {
         autordf::Uri type = prop.asResource().name();
         if ( type == typeIRI ) {
             return true;
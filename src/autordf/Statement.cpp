@@ -8,6 +8,9 @@ std::ostream& operator<<(std::ostream& os, const Statement& s) {
     os << "S: "<< s.subject << std::endl;
     os << "P: "<< s.predicate << std::endl;
     os << "O: "<< s.object << std::endl;
+    if ( !s.graph.empty() ) {
+        os << "G: "<< s.graph << std::endl;
+    }
     return os;
 }
 
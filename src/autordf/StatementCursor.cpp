@@ -0,0 +1,53 @@
+#include "autordf/internal/cAPI.h"
+#include "autordf/StatementCursor.h"
+
+#include "autordf/internal/Stream.h"
+#include "autordf/Model.h"
+#include "autordf/internal/ModelPrivate.h"
+#include "autordf/internal/StatementConverter.h"
+#include "autordf/Exception.h"
+
+namespace autordf {
+
+using namespace internal;
+
+StatementCursor::StatementCursor(const Statement& query, const Model *m) : _model(m->_model), _revision(m->_model->revision()) {
+#if defined(USE_REDLAND)
+    Statement q(query);
+    std::shared_ptr<librdf_statement> search(StatementConverter::toCAPIStatement(&q));
+    c_api_stream *cstream = q.graph.empty() ? librdf_model_find_statements(_model->get(), search.get()) :
+                            librdf_model_find_statements_in_context(_model->get(), search.get(), q.graph.get());
+    if ( !cstream ) {
+        throw InternalError("Redland librdf_model_find_statements failed");
+    }
+    _stream.reset(new Stream(cstream));
+#elif defined(USE_SORD)
+    SordQuad quad;
+    StatementConverter::toCAPIStatement(&query, &quad);
+    _stream.reset(new Stream(sord_find(_model->get(), quad)));
+#endif
+    _model->addCursorStream(_stream);
+}
+
+bool StatementCursor::next(Statement* stmt) {
+    if ( _done ) {
+        return false;
+    }
+    if ( _model->revision() != _revision ) {
+        throw ModelChanged("Model was changed while reading statements from it");
+    }
+    if ( _started ) {
+        _done = !_stream->next();
+    } else {
+        _started = true;
+        _done = _stream->end();
+    }
+    if ( _done ) {
+        _stream.reset();
+        return false;
+    }
+    *stmt = *_stream->getObject();
+    return true;
+}
+
+}
@@ -57,7 +57,8 @@ StatementList::const_iterator StatementList::begin() const {
 std::shared_ptr<Stream> StatementList::createNewStream() const {
     Statement query(_query);
     std::shared_ptr<librdf_statement> search(StatementConverter::toCAPIStatement(&query));
-    c_api_stream *cstream = librdf_model_find_statements(_m->_model->get(), search.get());
+    c_api_stream *cstream = query.graph.empty() ? librdf_model_find_statements(_m->_model->get(), search.get()) :
+                            librdf_model_find_statements_in_context(_m->_model->get(), search.get(), query.graph.get());
     std::shared_ptr<Stream> stream(new Stream(cstream));
     if ( !cstream ) {
         throw InternalError("Redland librdf_model_find_statements failed");
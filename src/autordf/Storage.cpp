@@ -8,8 +8,8 @@
 namespace autordf {
 
 Storage::Storage() : _world(new internal::World()) {
-    /* Default storage type, which is memory hash */
-    _storage = librdf_new_storage(_world->get(), "hashes", nullptr, "hash-type='memory'");
+    /* Default storage type, which is memory hash, with named graphs support */
+    _storage = librdf_new_storage(_world->get(), "hashes", nullptr, "hash-type='memory',contexts='yes'");
     if (!_storage) {
         throw InternalError("Failed to create RDF data storage");
     }
@@ -36,24 +36,18 @@ std::string Uri::prefixPart() const {
 
 std::string Uri::QName(const Model *model) const {
     if (model) {
-        std::string bestValue;
         std::string bestPrefix;
-        for (auto const& p : model->namespacesPrefixes()) {
-            auto value = p.second;
-            if ( (find(value) == 0) && (value.length() > bestPrefix.length()) ) {
-                bestValue = value;
-                bestPrefix = p.first;
-            }
-        }
-        if ( (find(model->baseUri()) == 0) && (model->baseUri().length() > bestPrefix.length()) ) {
-            bestValue = model->baseUri();
+        std::string::size_type bestLength = model->longestNamespace(*this, &bestPrefix);
+        const std::string& baseUri = model->baseUri();
+        if ( (compare(0, baseUri.length(), baseUri) == 0) && (baseUri.length() > bestLength) ) {
+            bestLength = baseUri.length();
             bestPrefix = "";
         }
         std::string ret = bestPrefix;
         if ( bestPrefix.length() ) {
             ret.push_back(':');
         }
-        ret.append(substr(bestValue.length()));
+        ret.append(*this, bestLength, npos);
         return ret;
     }
     else {
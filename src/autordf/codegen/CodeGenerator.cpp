@@ -1,11 +1,27 @@
 #include "CodeGenerator.h"
 
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "autordf/ontology/OntologyCache.h"
+
 #include "Environment.h"
 
 namespace autordf {
 namespace codegen {
 void CodeGenerator::run() {
-    ontology::Ontology ontology = {_factory, Environment::verbose};
+    std::unique_ptr<ontology::Ontology> ontology;
+    if (Environment::ontologyCache.empty()) {
+        ontology.reset(new ontology::Ontology(_factory, Environment::verbose));
+    } else {
+        ontology = ontology::OntologyCache(Environment::ontologyCache, Environment::owlfiles,
+                                           _factory->namespacesPrefixes(), _factory->baseUri()).load(_factory, Environment::verbose);
+    }
 
     inja::Environment renderer {Environment::tpldir, Environment::outdir};
 
@@ -58,7 +74,73 @@ void CodeGenerator::run() {
         return result;
     });
 
-    runInternal(ontology, renderer);
+    _manifest.reset(new Manifest(Environment::manifest));
+    runInternal(*ontology, renderer);
+    _manifest->save();
+}
+
+void CodeGenerator::render(const std::vector<RenderJob>& jobs, inja::Environment& renderer) {
+    // Parsing updates renderer included templates storage: do it before starting threads
+    std::map<std::string, inja::Template> templates;
+    for (const RenderJob& job : jobs) {
+        if (!templates.count(job.templateName)) {
+            templates.emplace(job.templateName, renderer.parse_template(job.templateName));
+        }
+    }
+
+    std::map<std::string, std::string> templateKeys;
+    for (auto const& tpl : templates) {
+        templateKeys[tpl.first] = _manifest->templateKey(tpl.first);
+    }
+
+    std::atomic<size_t> next(0);
+    std::mutex mutex;
+    std::exception_ptr error;
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < jobs.size(); i = next++) {
+            const RenderJob& job = jobs[i];
+            try {
+                std::string key = Manifest::fileKey(job.fileName, templateKeys.at(job.templateName), *job.data);
+                const char *status = "Up to date.";
+                if (!_manifest->upToDate(job.fileName, key)) {
+                    std::ostringstream out;
+                    renderer.render_to(out, templates.at(job.templateName), *job.data);
+                    status = Environment::writeFile(job.fileName, out.str()) ? "Done." : "Unchanged.";
+                }
+                _manifest->addFile(job.fileName, key);
+                if (Environment::verbose) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    std::cout << "Rendering template '" << job.templateName << "' to '" << job.fileName << "'... "
+                              << status << std::endl;
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                // Let other threads run out of jobs
+                next = jobs.size();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    unsigned int threadCount = std::min<size_t>(Environment::jobs, jobs.size());
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void CodeGenerator::addToManifest(const Klass& klass) {
+    _manifest->addClass(klass.templateData());
 }
 }
 }
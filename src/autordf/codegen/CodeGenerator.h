@@ -1,10 +1,17 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <inja/inja.hpp>
 
 #include "autordf/Factory.h"
 #include "autordf/ontology/Ontology.h"
 
+#include "Klass.h"
+#include "Manifest.h"
+
 namespace autordf {
 namespace codegen {
 /**
@@ -25,8 +32,33 @@ protected:
     Factory* _factory;
     std::string _whitespaceChar;
     std::string _indentChar;
+    std::unique_ptr<Manifest> _manifest;
+
+    /**
+     * A file to render
+     */
+    struct RenderJob {
+        /** Template to render, relative to templates directory */
+        std::string templateName;
+        /** File to render it to, relative to output directory */
+        std::string fileName;
+        /** Data to render template with, must outlive rendering */
+        const nlohmann::json* data;
+    };
 
     virtual void runInternal(const ontology::Ontology& ontology, inja::Environment& renderer) = 0;
+
+    /**
+     * Renders all jobs, on Environment::jobs threads.
+     * Each template is parsed once. Files rendered from the same inputs by the previous run are not rendered again,
+     * files that already have the rendered content are left untouched
+     */
+    void render(const std::vector<RenderJob>& jobs, inja::Environment& renderer);
+
+    /**
+     * Records a generated class in the manifest, to report its changes
+     */
+    void addToManifest(const Klass& klass);
 };
 }
 }
@@ -1,11 +1,14 @@
 #include "Environment.h"
 
 #include <sys/stat.h>
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <stdexcept>
 #include <fstream>
+#include <iterator>
 #include <sstream>
+#include <thread>
 
 #include "autordf/I18StringVector.h"
 
@@ -17,6 +20,10 @@ std::string Environment::outdir = ".";
 std::string Environment::namespace_ = "";
 std::vector<std::string> Environment::preferredLang = {"en", "fr"};
 bool Environment::verbose = false;
+std::string Environment::ontologyCache = "";
+std::vector<std::string> Environment::owlfiles;
+std::string Environment::manifest = "";
+unsigned int Environment::jobs = std::max(1U, std::thread::hardware_concurrency());
 
 void Environment::createOutDirectory(const std::string& relativeDirName) {
     if (!relativeDirName.empty() && relativeDirName != ".") {
@@ -50,6 +57,28 @@ void Environment::createFile(const std::string& fileName, std::ofstream& ofs, bo
     }
 }
 
+bool Environment::writeFile(const std::string& fileName, const std::string& content) {
+    const std::string path = Environment::outdir + '/' + fileName;
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        if (ifs.is_open()) {
+            std::string existing((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+            if (existing == content) {
+                return false;
+            }
+        }
+    }
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open()) {
+        throw std::runtime_error("Unable to open " + fileName + " file");
+    }
+    ofs << content;
+    if (!ofs) {
+        throw std::runtime_error("Unable to write " + fileName + " file");
+    }
+    return true;
+}
+
 std::string Environment::propertyI18(const std::vector<PropertyValue>& values) {
     if (values.empty()) {
         return "";
@@ -39,6 +39,26 @@ public:
      */
     static bool verbose;
 
+    /**
+     * Stores the ontology cache file, if empty the ontology is always extracted from the model
+     */
+    static std::string ontologyCache;
+
+    /**
+     * Stores the files the model was loaded from, their content keys the ontology cache
+     */
+    static std::vector<std::string> owlfiles;
+
+    /**
+     * Stores the manifest file, if empty every file is rendered again
+     */
+    static std::string manifest;
+
+    /**
+     * Number of files rendered concurrently
+     */
+    static unsigned int jobs;
+
     /**
      * Creates a folder with a relative path to the out directory
      *
@@ -63,6 +83,17 @@ public:
      */
     static void createFile(const std::string& fileName, std::ofstream& ofs, bool append = false);
 
+    /**
+     * Writes a file with a path relative to the out directory, unless it already has this content.
+     * Leaving unchanged files untouched keeps build systems from compiling them again
+     *
+     * @param fileName a path relative to the out directory
+     * @param content the whole file content
+     *
+     * @return true if file was written, false if it already had this content
+     */
+    static bool writeFile(const std::string& fileName, const std::string& content);
+
     /**
      * Returns the best property translation from a list of values using preferredLang
      *
@@ -1,5 +1,8 @@
 #include "Klass.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <inja/inja.hpp>
 
 #include "autordf/ontology/Ontology.h"
@@ -10,17 +13,9 @@
 
 namespace autordf {
 namespace codegen {
-Klass::Klass(const ontology::Klass& ontology, inja::Environment& renderer) :
-    _renderer(renderer),
-    _ontology(ontology),
-    _templateData() {
-}
-
 Klass::Klass(const ontology::Klass& ontology) :
-    _renderer(),
     _ontology(ontology),
     _templateData() {
-
 }
 
 void Klass::buildTemplateData(bool withDependency) {
@@ -39,6 +34,7 @@ void Klass::buildTemplateData(bool withDependency) {
     _templateData["fullInterfaceName"] = _templateData.value("fullPackageName", "") + _packageSeparator + _templateData.value("interfaceName", "");
     _templateData["hasOneOf"] = !_ontology.oneOfValues().empty();
     _templateData["classComment"] = buildCommentSection(_ontology);
+    _summaryData = _templateData;
 
     if (withDependency) {
         buildDependencies();
@@ -148,6 +144,17 @@ void Klass::buildOneOfValues() {
 
         _templateData["oneOfValues"].push_back(jsonValue);
     }
+
+    // Sorted copies, for generated code to look values up by binary search
+    auto sortedBy = [this](const char *key) {
+        std::vector<nlohmann::json> values(_templateData["oneOfValues"].begin(), _templateData["oneOfValues"].end());
+        std::sort(values.begin(), values.end(), [key](const nlohmann::json& a, const nlohmann::json& b) {
+            return a[key].get<std::string>() < b[key].get<std::string>();
+        });
+        return nlohmann::json(values);
+    };
+    _templateData["oneOfValuesByIri"] = sortedBy("rdfName");
+    _templateData["oneOfValuesByName"] = sortedBy("name");
 }
 
 void Klass::buildAncestors() {
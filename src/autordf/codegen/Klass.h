@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <inja/inja.hpp>
 
@@ -15,15 +17,17 @@ namespace codegen {
 class Klass {
 public:
     /**
-     * Constructs a class for rendering
-     *
-     * @param ontology the class ontology
-     * @param renderer the renderer to use to render this class
+     * A file generated for this class
      */
-    Klass(const ontology::Klass& ontology, inja::Environment& renderer);
+    struct OutputFile {
+        /** Template to render, relative to templates directory */
+        std::string templateName;
+        /** File to render it to, relative to output directory */
+        std::string fileName;
+    };
 
     /**
-     * Constructs a class for use as a dependency
+     * Constructs a class for rendering, or for use as a dependency
      *
      * @param ontology the class ontology
      */
@@ -42,14 +46,24 @@ public:
      * @return the Json representation of the class ontology
      * @see https://confluence.rennes.ariadnext.com/display/OCR/AutoRDF+template+system
      */
-    nlohmann::json templateData() const {
+    const nlohmann::json& templateData() const {
         return _templateData;
     }
 
+    /**
+     * Gives the Json representation of the class naming only, without properties and dependencies,
+     * as used for files listing several classes
+     */
+    const nlohmann::json& summaryData() const {
+        return _summaryData;
+    }
+
     /**
      * Implement this function for your target language
+     *
+     * @return the files to generate for this class
      */
-    virtual void generate() const = 0;
+    virtual std::vector<OutputFile> outputFiles() const = 0;
 
     std::string className() const;
     std::string interfaceName() const;
@@ -58,7 +72,6 @@ public:
     std::string fullPackageName() const;
 
 protected:
-    mutable inja::Environment _renderer;
     std::string _interfacePrefix = "I";
     std::string _packageSeparator = "::";
     std::string _pathSeparator = "/";
@@ -66,6 +79,7 @@ protected:
 private:
     const ontology::Klass& _ontology;
     nlohmann::json _templateData;
+    nlohmann::json _summaryData;
 
     virtual std::unique_ptr<Klass> buildDependency(const ontology::Klass& ontology) const = 0;
     void buildDependencies();
@@ -0,0 +1,192 @@
+#include "Manifest.h"
+
+#include <sys/stat.h>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+#include "Environment.h"
+
+namespace autordf {
+namespace codegen {
+namespace {
+// Increase when the generator changes its output for the same inputs
+const char *const MANIFEST_HEADER = "autordfcodegen-manifest 1";
+
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+void fnv1a(uint64_t *hash, std::string_view data) {
+    for (char c : data) {
+        *hash ^= static_cast<unsigned char>(c);
+        *hash *= FNV_PRIME;
+    }
+    // Boundaries are part of the hash: splitting content differently gives another hash
+    uint64_t size = data.size();
+    for (size_t i = 0; i < sizeof(size); ++i) {
+        *hash ^= (size >> (8 * i)) & 0xFF;
+        *hash *= FNV_PRIME;
+    }
+}
+
+std::string toHex(uint64_t hash) {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return ss.str();
+}
+}
+
+Manifest::Manifest(const std::string& fileName) : _fileName(fileName) {
+    if (_fileName.empty()) {
+        return;
+    }
+    std::ifstream ifs(_fileName);
+    std::string line;
+    if (!ifs || !std::getline(ifs, line) || line != MANIFEST_HEADER) {
+        if (Environment::verbose) {
+            std::cout << "No usable manifest in " << _fileName << ", rendering all files" << std::endl;
+        }
+        return;
+    }
+    // Each line is: kind hash name, name being the rest of the line
+    while (std::getline(ifs, line)) {
+        std::istringstream ls(line);
+        std::string kind, key, name;
+        if (!(ls >> kind >> key) || !std::getline(ls >> std::ws, name)) {
+            continue;
+        }
+        if (kind == "file") {
+            _previousFiles[name] = key;
+        } else if (kind == "class") {
+            _previousClasses[name] = key;
+        }
+    }
+    _loaded = true;
+}
+
+std::string Manifest::templateKey(const std::string& templateName) {
+    auto it = _templateKeys.find(templateName);
+    if (it == _templateKeys.end()) {
+        std::string content;
+        std::set<std::string> visited;
+        addTemplate(templateName, &content, &visited);
+        it = _templateKeys.emplace(templateName, hash(content)).first;
+    }
+    return it->second;
+}
+
+void Manifest::addTemplate(const std::string& templateName, std::string* content, std::set<std::string>* visited) const {
+    if (!visited->insert(templateName).second) {
+        return;
+    }
+    std::ifstream ifs(Environment::tpldir + templateName, std::ios::binary);
+    if (!ifs) {
+        throw std::runtime_error("Unable to read template " + templateName);
+    }
+    std::string tpl((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    *content += templateName;
+    *content += '\0';
+    *content += tpl;
+    *content += '\0';
+
+    // Included templates are looked up relatively to the including one, as inja does
+    static const std::regex INCLUDE("\\{%-?\\s*(include|extends)\\s+\"([^\"]+)\"");
+    const std::filesystem::path directory = std::filesystem::path(templateName).parent_path();
+    for (std::sregex_iterator match(tpl.begin(), tpl.end(), INCLUDE), end; match != end; ++match) {
+        addTemplate((directory / (*match)[2].str()).lexically_normal().generic_string(), content, visited);
+    }
+}
+
+std::string Manifest::fileKey(const std::string& fileName, const std::string& templateKey, const nlohmann::json& data) {
+    uint64_t h = FNV_OFFSET_BASIS;
+    fnv1a(&h, MANIFEST_HEADER);
+    fnv1a(&h, fileName);
+    fnv1a(&h, templateKey);
+    fnv1a(&h, data.dump());
+    return toHex(h);
+}
+
+bool Manifest::upToDate(const std::string& fileName, const std::string& key) const {
+    if (!_loaded) {
+        return false;
+    }
+    auto it = _previousFiles.find(fileName);
+    if (it == _previousFiles.end() || it->second != key) {
+        return false;
+    }
+    struct stat st;
+    return ::stat((Environment::outdir + '/' + fileName).c_str(), &st) == 0;
+}
+
+void Manifest::addFile(const std::string& fileName, const std::string& key) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _files[fileName] = key;
+}
+
+void Manifest::addClass(const nlohmann::json& data) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _classes[data.value("rdfName", "")] = hash(data.dump());
+}
+
+void Manifest::save() const {
+    if (_fileName.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_loaded) {
+        for (auto const& klass : _classes) {
+            auto previous = _previousClasses.find(klass.first);
+            if (previous == _previousClasses.end()) {
+                std::cout << "Class '" << klass.first << "' added" << std::endl;
+            } else if (previous->second != klass.second) {
+                std::cout << "Class '" << klass.first << "' changed" << std::endl;
+            }
+        }
+        for (auto const& klass : _previousClasses) {
+            if (!_classes.count(klass.first)) {
+                std::cout << "Class '" << klass.first << "' removed" << std::endl;
+            }
+        }
+        for (auto const& file : _previousFiles) {
+            if (!_files.count(file.first)) {
+                std::cout << "File '" << file.first << "' is not generated anymore" << std::endl;
+            }
+        }
+    }
+
+    // Write to a temporary file first, so that an interrupted run never leaves a partial manifest
+    const std::string tmpFile = _fileName + ".tmp";
+    {
+        std::ofstream ofs(tmpFile, std::ios::trunc);
+        ofs << MANIFEST_HEADER << '\n';
+        for (auto const& klass : _classes) {
+            ofs << "class " << klass.second << ' ' << klass.first << '\n';
+        }
+        for (auto const& file : _files) {
+            ofs << "file " << file.second << ' ' << file.first << '\n';
+        }
+        if (!ofs) {
+            std::remove(tmpFile.c_str());
+            throw std::runtime_error("Unable to write manifest " + _fileName);
+        }
+    }
+    if (std::rename(tmpFile.c_str(), _fileName.c_str()) != 0) {
+        std::remove(tmpFile.c_str());
+        throw std::runtime_error("Unable to write manifest " + _fileName);
+    }
+}
+
+std::string Manifest::hash(std::string_view content) {
+    uint64_t h = FNV_OFFSET_BASIS;
+    fnv1a(&h, content);
+    return toHex(h);
+}
+}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include <inja/inja.hpp>
+
+namespace autordf {
+namespace codegen {
+/**
+ * Remembers, from one run to the next, the inputs each generated file was rendered from:
+ * a file whose template and template data did not change is not rendered again.
+ * Also reports the classes that changed or were removed since the previous run
+ */
+class Manifest {
+public:
+    /**
+     * Reads the manifest written by the previous run, if any
+     *
+     * @param fileName the manifest file, if empty every file is rendered and nothing is saved
+     */
+    explicit Manifest(const std::string& fileName);
+
+    /**
+     * Hash of a template content along with the content of all the templates it includes, recursively
+     *
+     * @param templateName a template path, relative to templates directory
+     */
+    std::string templateKey(const std::string& templateName);
+
+    /**
+     * Hash of all the inputs a file is rendered from. Thread safe
+     *
+     * @param fileName the generated file, relative to output directory
+     * @param templateKey the hash of the template it is rendered with, as returned by templateKey()
+     * @param data the template data it is rendered with
+     */
+    static std::string fileKey(const std::string& fileName, const std::string& templateKey, const nlohmann::json& data);
+
+    /**
+     * Tells if a file exists and was rendered with the same inputs by the previous run. Thread safe
+     */
+    bool upToDate(const std::string& fileName, const std::string& key) const;
+
+    /**
+     * Records the inputs a file was rendered from in this run. Thread safe
+     */
+    void addFile(const std::string& fileName, const std::string& key);
+
+    /**
+     * Records the template data of a generated class, to report its changes
+     */
+    void addClass(const nlohmann::json& data);
+
+    /**
+     * Prints the classes that changed or were removed since the previous run,
+     * then writes the manifest for the next run
+     */
+    void save() const;
+
+    /**
+     * Hash of some content, as an hexadecimal string
+     */
+    static std::string hash(std::string_view content);
+
+private:
+    std::string _fileName;
+    bool _loaded = false;
+
+    std::map<std::string, std::string> _previousFiles;
+    std::map<std::string, std::string> _previousClasses;
+    std::map<std::string, std::string> _files;
+    std::map<std::string, std::string> _classes;
+    std::map<std::string, std::string> _templateKeys;
+
+    mutable std::mutex _mutex;
+
+    void addTemplate(const std::string& templateName, std::string* content, std::set<std::string>* visited) const;
+};
+}
+}
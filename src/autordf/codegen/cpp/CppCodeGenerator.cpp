@@ -29,8 +29,12 @@ void CppCodeGenerator::runInternal(const ontology::Ontology& ontology, inja::Env
         std::cout << "Starting C++ code generation" << std::endl;
     }
 
+    // Template data of each class is built once, then shared by all files it is rendered to
+    std::vector<std::unique_ptr<CppKlass>> klasses;
+    std::vector<RenderJob> jobs;
     for (auto const& klassMapItem: ontology.classUri2Ptr()) {
-        auto klass = CppKlass(*klassMapItem.second, renderer);
+        klasses.emplace_back(new CppKlass(*klassMapItem.second));
+        CppKlass& klass = *klasses.back();
         klass.setSeparateHeaders(_separateHeaders);
         klass.buildTemplateData();
 
@@ -41,12 +45,9 @@ void CppCodeGenerator::runInternal(const ontology::Ontology& ontology, inja::Env
         }
         cppNameSpaces.insert(klass.basePackageName());
 
-        if (Environment::verbose) {
-            std::cout << "Generating class '" << klass.className() << "'..." << std::endl;
-        }
-        klass.generate();
-        if (Environment::verbose) {
-            std::cout << "Generation done." << std::endl;
+        addToManifest(klass);
+        for (Klass::OutputFile& file : klass.outputFiles()) {
+            jobs.push_back({std::move(file.templateName), std::move(file.fileName), &klass.templateData()});
         }
     }
 
@@ -56,87 +57,46 @@ void CppCodeGenerator::runInternal(const ontology::Ontology& ontology, inja::Env
         headerPrefixPath = "include/";
     }
 
-    if (Environment::verbose) {
-        std::cout << "Generating all inclusions files..." << std::endl;
-    }
+    std::vector<nlohmann::json> inclusionsData;
+    inclusionsData.reserve(cppNameSpaces.size());
     for (const std::string& cppNameSpace : cppNameSpaces) {
-        std::ofstream out;
-
-        if (!Environment::namespace_.empty()) {
-            Environment::createFile(
-                    headerPrefixPath + Environment::namespace_ + "/" + cppNameSpace + "/" + cppNameSpace + ".h", out);
-        } else {
-            Environment::createFile(headerPrefixPath + cppNameSpace + "/" + cppNameSpace + ".h", out);
-        }
-
-        nlohmann::json data;
-
-        if (Environment::verbose) {
-            std::cout << "For namespace '" << cppNameSpace << "'" << std::endl;
-        }
-
+        inclusionsData.emplace_back();
+        nlohmann::json& data = inclusionsData.back();
         data["namespace"] = cppNameSpace;
         data["classes"] = nlohmann::json::array();
 
-        for (auto const& klassMapItem: ontology.classUri2Ptr()) {
-            auto klass = CppKlass(*klassMapItem.second, renderer);
-            klass.setSeparateHeaders(_separateHeaders);
-            klass.buildTemplateData(false);
-            if (klass.basePackageName() == cppNameSpace) {
-                data["classes"].push_back(klass.templateData());
+        for (auto const& klass: klasses) {
+            if (klass->basePackageName() == cppNameSpace) {
+                data["classes"].push_back(klass->summaryData());
             }
         }
 
-        if (Environment::verbose) {
-            std::cout << "Rendering template 'cpp/all_inclusions.tpl' to '" << Environment::outdir << "/" << headerPrefixPath << cppNameSpace << "/" << cppNameSpace << ".h'...";
-        }
-        auto tpl = renderer.parse_template("cpp/all_inclusions.tpl");
-        renderer.render_to(out, tpl, data);
-        out.close();
-        if (Environment::verbose) {
-            std::cout << " Done." << std::endl;
+        if (!Environment::namespace_.empty()) {
+            jobs.push_back({"cpp/all_inclusions.tpl", headerPrefixPath + Environment::namespace_ + "/" + cppNameSpace + "/" + cppNameSpace + ".h", &data});
+        } else {
+            jobs.push_back({"cpp/all_inclusions.tpl", headerPrefixPath + cppNameSpace + "/" + cppNameSpace + ".h", &data});
         }
     }
-    if (Environment::verbose) {
-        std::cout << "Generation done." << std::endl;
-    }
 
     // Generate all in one cpp file
+    nlohmann::json allInOneData;
     if (_allInOne) {
-        if (Environment::verbose) {
-            std::cout << "Generating all-in-one cpp file..." << std::endl;
+        allInOneData["classes"] = nlohmann::json::array();
+        for (auto const& klass: klasses) {
+            allInOneData["classes"].push_back(klass->summaryData());
         }
 
-        std::ofstream out;
         if (!Environment::namespace_.empty()) {
-            Environment::createFile("/" + Environment::namespace_ +"/AllInOne.cpp", out);
+            jobs.push_back({"cpp/all_in_one.tpl", Environment::namespace_ + "/AllInOne.cpp", &allInOneData});
         } else {
-            Environment::createFile("/AllInOne.cpp", out);
-        }
-
-        nlohmann::json data;
-        data["classes"] = nlohmann::json::array();
-
-        for (auto const& klassMapItem: ontology.classUri2Ptr()) {
-            auto klass = CppKlass(*klassMapItem.second, renderer);
-            klass.setSeparateHeaders(_separateHeaders);
-            klass.buildTemplateData(false);
-            data["classes"].push_back(klass.templateData());
+            jobs.push_back({"cpp/all_in_one.tpl", "AllInOne.cpp", &allInOneData});
         }
+    }
 
-        if (Environment::verbose) {
-            std::cout << "Rendering template 'cpp/all_in_one.tpl' to '" << Environment::outdir << "/AllInOne.cpp'...";
-        }
-        auto tpl = renderer.parse_template("cpp/all_in_one.tpl");
-        renderer.render_to(out, tpl, data);
-        out.close();
-        if (Environment::verbose) {
-            std::cout << " Done." << std::endl;
-        }
+    render(jobs, renderer);
 
-        if (Environment::verbose) {
-            std::cout << "Generation done." << std::endl;
-        }
+    if (Environment::verbose) {
+        std::cout << "Generation done." << std::endl;
     }
 }
 
@@ -7,10 +7,9 @@ namespace codegen {
 namespace cpp {
 class CppKlass : public Klass {
 public:
-    CppKlass(const ontology::Klass& ontology, inja::Environment& renderer) : Klass(ontology, renderer) {}
     explicit CppKlass(const ontology::Klass& ontology) : Klass(ontology) {}
 
-    void generate() const override;
+    std::vector<OutputFile> outputFiles() const override;
 
     void setSeparateHeaders(bool state);
 
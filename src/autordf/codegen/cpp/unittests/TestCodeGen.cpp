@@ -26,4 +26,9 @@ int main() {
     for ( const foaf::Person& o : p2.knowsList() ) {
         std::cout << o.nameList().front() << ", ";
     }
+    std::cout << std::endl;
+
+    // Or all properties at once
+    foaf::Person::Data data = p2.load();
+    std::cout << "  knows " << data.knows.size() << " persons" << std::endl;
 }
@@ -22,7 +22,7 @@ int main(int argc, char** argv) {
 
     namespace po = boost::program_options;
 
-    po::options_description desc("Usage: autordfcodegen [-v] [-a] [-n namespacemap] [-o outdir] owlfile1 [owlfile2...]\n"
+    po::options_description desc("Usage: autordfcodegen [-v] [-a] [-n namespacemap] [-o outdir] [-c cachefile] [-m manifest] [-j jobs] owlfile1 [owlfile2...]\n"
                                  "\tProcesses an OWL file, and generates C++ classes from it in current directory\n");
 
     desc.add_options()
@@ -36,7 +36,10 @@ int main(int argc, char** argv) {
             ("owlfile", po::value< std::vector<std::string> >(), "Input file (repeated)")
             ("preferredLang,l", po::value< std::vector<std::string> >(), "Preferred languages for documentation (repeated)")
             ("tpldir,t", po::value< std::string >(), "Folder containing the template files. Defaults to 'template' inside the current directory.")
-            ("separate-headers,sh", "Generate the header files in a separate folder (cpp only)");
+            ("cache,c", po::value< std::string >(), "Binary file the ontology is cached in. It is extracted again only when the owl files change.")
+            ("manifest,m", po::value< std::string >(), "File listing the inputs of each generated file. Files are rendered again only when their inputs change, changed and removed classes are reported.")
+            ("separate-headers,sh", "Generate the header files in a separate folder (cpp only)")
+            ("jobs,j", po::value< unsigned int >(), "Number of files rendered concurrently. Defaults to the number of processors.");
 
     po::positional_options_description p;
     p.add("owlfile", -1);
@@ -92,6 +95,30 @@ int main(int argc, char** argv) {
         }
     }
 
+    if(vm.count("cache")) {
+        autordf::codegen::Environment::ontologyCache = vm["cache"].as<std::string>();
+
+        if (autordf::codegen::Environment::verbose) {
+            std::cout << "Ontology cache: " << autordf::codegen::Environment::ontologyCache << std::endl;
+        }
+    }
+
+    if(vm.count("manifest")) {
+        autordf::codegen::Environment::manifest = vm["manifest"].as<std::string>();
+
+        if (autordf::codegen::Environment::verbose) {
+            std::cout << "Manifest: " << autordf::codegen::Environment::manifest << std::endl;
+        }
+    }
+
+    if(vm.count("jobs")) {
+        autordf::codegen::Environment::jobs = std::max(1U, vm["jobs"].as<unsigned int>());
+
+        if (autordf::codegen::Environment::verbose) {
+            std::cout << "Rendering jobs: " << autordf::codegen::Environment::jobs << std::endl;
+        }
+    }
+
     if(vm.count("outdir")) {
         autordf::codegen::Environment::outdir = vm["outdir"].as<std::string>();
 
@@ -121,7 +148,8 @@ int main(int argc, char** argv) {
         f.addNamespacePrefix("owl", autordf::ontology::Ontology::OWL_NS);
         f.addNamespacePrefix("rdfs", autordf::ontology::Ontology::RDFS_NS);
 
-        for ( std::string owlfile: vm["owlfile"].as< std::vector<std::string> >() ) {
+        autordf::codegen::Environment::owlfiles = vm["owlfile"].as< std::vector<std::string> >();
+        for ( std::string owlfile: autordf::codegen::Environment::owlfiles ) {
             if ( autordf::codegen::Environment::verbose ) {
                 std::cout << "Loading " << owlfile << " into model." << std::endl;
             }
@@ -1,5 +1,7 @@
 #include "PythonCodeGenerator.h"
 
+#include <map>
+
 #include "../Environment.h"
 
 #include "PythonKlass.h"
@@ -12,35 +14,51 @@ void PythonCodeGenerator::runInternal(const ontology::Ontology& ontology, inja::
         std::cout << "Starting Python code generation" << std::endl;
     }
 
-    std::vector<std::string> alreadyCreated;
+    // Template data of each class is built once, then shared by all files it is rendered to
+    std::vector<std::unique_ptr<PythonKlass>> klasses;
+    std::vector<RenderJob> jobs;
     for (auto const& klassMapItem: ontology.classUri2Ptr()) {
-        auto klass = PythonKlass(*klassMapItem.second, renderer);
+        klasses.emplace_back(new PythonKlass(*klassMapItem.second));
+        PythonKlass& klass = *klasses.back();
         klass.buildTemplateData();
 
         // created directory if needed
         Environment::createOutDirectory(klass.packagePath());
 
-        if (Environment::verbose) {
-            std::cout << "Generating class '" << klass.className() << "'..." << std::endl;
-        }
-        klass.generate();
-        if (Environment::verbose) {
-            std::cout << "Generation done." << std::endl;
+        addToManifest(klass);
+        for (Klass::OutputFile& file : klass.outputFiles()) {
+            jobs.push_back({std::move(file.templateName), std::move(file.fileName), &klass.templateData()});
         }
+    }
 
-        if (Environment::verbose) {
-            std::cout << "Adding class to __init__.py" << std::endl;
-        }
-        std::ofstream out;
-        auto isCreated = std::find(alreadyCreated.begin(), alreadyCreated.end(), klass.packagePath()) != alreadyCreated.end();
-        Environment::createFile(klass.packagePath() + "/__init__.py", out, isCreated);
-        auto tpl = renderer.parse_template("python/init.tpl");
+    render(jobs, renderer);
+
+    // Each package __init__.py lists its classes, in generation order
+    if (Environment::verbose) {
+        std::cout << "Generating __init__.py files..." << std::endl;
+    }
+    auto tpl = renderer.parse_template("python/init.tpl");
+    std::vector<std::string> packagePaths;
+    std::map<std::string, std::string> initContents;
+    for (auto const& klass: klasses) {
         nlohmann::json data;
-        data["className"] = klass.className();
-        data["interfaceName"] = klass.interfaceName();
-        data["module"] = klass.fullPackageName();
-        renderer.render_to(out, tpl, data);
-        alreadyCreated.push_back(klass.packagePath());
+        data["className"] = klass->className();
+        data["interfaceName"] = klass->interfaceName();
+        data["module"] = klass->fullPackageName();
+        auto inserted = initContents.emplace(klass->packagePath(), std::string());
+        if (inserted.second) {
+            packagePaths.push_back(klass->packagePath());
+        }
+        inserted.first->second += renderer.render(tpl, data);
+    }
+    for (const std::string& packagePath : packagePaths) {
+        const std::string& content = initContents[packagePath];
+        Environment::writeFile(packagePath + "/__init__.py", content);
+        _manifest->addFile(packagePath + "/__init__.py", Manifest::hash(content));
+    }
+
+    if (Environment::verbose) {
+        std::cout << "Generation done." << std::endl;
     }
 }
 }
@@ -7,10 +7,9 @@ namespace codegen {
 namespace python {
 class PythonKlass: public Klass {
 public:
-    PythonKlass(const ontology::Klass& ontology, inja::Environment& renderer);
     explicit PythonKlass(const ontology::Klass& ontology);
 
-    void generate() const override;
+    std::vector<OutputFile> outputFiles() const override;
 
 private:
     std::unique_ptr<Klass> buildDependency(const ontology::Klass& ontology) const override;
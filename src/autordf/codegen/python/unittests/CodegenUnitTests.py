@@ -44,6 +44,28 @@ class CodegenUnitTests(unittest.TestCase):
         self.assertTrue(objB.getBoolA("false").get())
         objB.removeBoolA("true")
         self.assertFalse(objB.getBoolA("false").get())
+    def test_find(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        objB = example.ex.ObjectB()
+        found = example.ex.ObjectB.find()
+        self.assertEqual(found, [objB])
+        self.assertIsInstance(found[0], example.ex.ObjectB)
+        with self.assertRaises(AttributeError):
+            objB.notAProperty = 1
+
+    def test_load_all(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        objA = example.ex.ObjectA()
+        objB = example.ex.ObjectB()
+        objA.setBoolA("true")
+        objA.addObjB(objB)
+        fields = objA.loadAll()
+        self.assertTrue(fields["boolA"].get())
+        self.assertEqual(fields["objB"], [objB])
+        self.assertIsInstance(fields["objB"][0], example.ex.ObjectB)
+        self.assertEqual(objB.loadAll()["boolA"], None)
 
 if __name__ == '__main__':
     unittest.main()
@@ -58,6 +58,28 @@ public:
      */
     static std::vector<{{ className }}> find();
 
+    /**
+     * @brief Values of all the properties of this class, ancestors ones included
+     */
+    struct Data: public {% for ancestor in ancestors %}{{ ancestor.fullInterfaceName }}::Data, public {% endfor %}{{ interfaceName }}::Data {
+    };
+
+    /**
+     * @brief Reads all the properties of this object at once
+     *
+     * Object is read in a single query, plus one per reified statement, where calling each getter
+     * issues at least one query per property.
+     * @throw PropertyNotFound if a mandatory property is not set
+     */
+    Data load() const;
+
+    /**
+     * @brief Writes all the properties of this object from data, replacing previous values.
+     *
+     * Model changes are notified once, when all properties are written
+     */
+    {{ className }}& store(const Data& data);
+
 {% for annotationKey in annotationKeys %}
     {% set key = annotationKey %}
     {% include "data_property/key_declaration.tpl" %}
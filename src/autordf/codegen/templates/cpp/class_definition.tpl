@@ -17,5 +17,24 @@
 std::vector<{{ className }}> {{ className }}::find() {
     return findHelper<{{ className }}>({{ interfaceName }}::TYPEIRI);
 }
+
+{{ className }}::Data {{ className }}::load() const {
+    const autordf::PropertySnapshot snapshot = Object::snapshot();
+    Data data;
+{% for ancestor in ancestors %}
+    {{ ancestor.fullInterfaceName }}::loadData(snapshot, &data);
+{% endfor %}
+    {{ interfaceName }}::loadData(snapshot, &data);
+    return data;
+}
+
+{{ className }}& {{ className }}::store(const Data& data) {
+    autordf::notification::NotifierLocker locker(Object::factory()->notifier());
+{% for ancestor in ancestors %}
+    {{ ancestor.fullInterfaceName }}::storeData(data);
+{% endfor %}
+    {{ interfaceName }}::storeData(data);
+    return *this;
+}
 {% include "leave_namespace.tpl" %}
 {% include "leave_internal.tpl" %}
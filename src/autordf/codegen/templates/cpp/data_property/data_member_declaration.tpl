@@ -0,0 +1,12 @@
+        /**
+         * Values of {{ property.fullName }} data property
+         */
+{% if property.maxCardinality <= 1 %}
+    {% if property.minCardinality > 0 %}
+        {{ cppType(property.type.value) }} {{ property.name }}{};
+    {% else %}
+        std::optional<{{ cppType(property.type.value) }}> {{ property.name }};
+    {% endif %}
+{% else %}
+        {{ cppManyType(property.type.value) }} {{ property.name }};
+{% endif %}
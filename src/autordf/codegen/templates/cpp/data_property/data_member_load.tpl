@@ -0,0 +1,17 @@
+{% if property.maxCardinality <= 1 %}
+    {% if property.minCardinality > 0 %}
+    data->{{ property.name }} = snapshot.value({{ property.name }}DataPropertyPredicate()).value(){% if not property.type.undefined %}.get<autordf::cvt::RdfTypeEnum::{{ property.type.rdf }}, {{ cppType(property.type.value) }}>(){% endif %};
+    {% else %}
+    if ( const autordf::Property *prop = snapshot.optionalValue({{ property.name }}DataPropertyPredicate()) ) {
+        data->{{ property.name }} = prop->value(){% if not property.type.undefined %}.get<autordf::cvt::RdfTypeEnum::{{ property.type.rdf }}, {{ cppType(property.type.value) }}>(){% endif %};
+    } else {
+        data->{{ property.name }}.reset();
+    }
+    {% endif %}
+{% else %}
+    {% if property.type.undefined %}
+    data->{{ property.name }} = snapshot.valueList({{ property.name }}DataPropertyPredicate(), {% if property.ordered %}true{% else %}false{% endif %});
+    {% else %}
+    data->{{ property.name }} = snapshot.valueList<autordf::cvt::RdfTypeEnum::{{ property.type.rdf }}, {{ cppType(property.type.value) }}>({{ property.name }}DataPropertyPredicate(), {% if property.ordered %}true{% else %}false{% endif %});
+    {% endif %}
+{% endif %}
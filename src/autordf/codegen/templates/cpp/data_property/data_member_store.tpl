@@ -0,0 +1,9 @@
+{% if property.maxCardinality <= 1 and property.minCardinality == 0 %}
+    if ( data.{{ property.name }} ) {
+        set{{ capitalize(property.name) }}(*data.{{ property.name }});
+    } else {
+        object().setPropertyValueList({{ property.name }}DataPropertyPredicate(), {}, false);
+    }
+{% else %}
+    set{{ capitalize(property.name) }}(data.{{ property.name }});
+{% endif %}
@@ -3,6 +3,11 @@
      */
     static const char* {{ property.name }}DataPropertyIri;
 
+    /**
+     * Predicate for {{ property.fullName }} data property, built on first call
+     */
+    static const autordf::Predicate& {{ property.name }}DataPropertyPredicate();
+
     {% if property.maxCardinality <= 1 %}
         {% if property.minCardinality > 0 %}
             {% include "getter_for_one_mandatory.tpl" %}
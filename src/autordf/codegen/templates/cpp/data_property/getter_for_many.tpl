@@ -5,6 +5,6 @@
     {{ cppManyType(property.type.value) }} {{ method }}() const{% if not property.type.undefined %};{% else %}{{ whitespace(1) }}{
 {% endif %}
 {% if property.type.undefined %}
-        return object().getPropertyValueList("{{ property.rdfName }}", {% if property.ordered %}true{% else %}false{% endif %});
+        return object().getPropertyValueList({{ property.name }}DataPropertyPredicate(), {% if property.ordered %}true{% else %}false{% endif %});
     }
 {% endif %}
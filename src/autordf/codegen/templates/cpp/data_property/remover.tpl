@@ -5,6 +5,6 @@
 {% set comment.throw = "PropertyNotFound if propertyIRI has not obj as value" %}
 {% include "../property_comment.tpl" %}
     {{ interfaceName }}& {{ method }}(const {{ cppType(property.type.value) }}& value) {
-        object().removePropertyValue("{{ property.rdfName }}", {% if not property.type.undefined %}autordf::PropertyValue().set<autordf::cvt::RdfTypeEnum::{{ rdfType(property.type.value) }}>(value){% else %}value{% endif %});
+        object().removePropertyValue({{ property.name }}DataPropertyPredicate(), {% if not property.type.undefined %}autordf::PropertyValue().set<autordf::cvt::RdfTypeEnum::{{ rdfType(property.type.value) }}>(value){% else %}value{% endif %});
         return *this;
     }
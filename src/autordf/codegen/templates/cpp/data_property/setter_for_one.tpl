@@ -4,7 +4,7 @@
 {% set comment.param = "value value to set for this property, removing all other values" %}
 {% include "../property_comment.tpl" %}
     {{ interfaceName }}& {{ method }}(const {{ cppType(property.type.value) }}& value) {
-        object().setPropertyValue("{{ property.rdfName }}", {% if not property.type.undefined %}autordf::PropertyValue().set<autordf::cvt::RdfTypeEnum::{{ rdfType(property.type.value) }}>(value));
+        object().setPropertyValue({{ property.name }}DataPropertyPredicate(), {% if not property.type.undefined %}autordf::PropertyValue().set<autordf::cvt::RdfTypeEnum::{{ rdfType(property.type.value) }}>(value));
         {% else %}value);
         {% endif %}
         return *this;
@@ -3,10 +3,11 @@
 // This is auto generated code by AutoRDF, do not edit !
 
 {% if hasOneOf %}
+#include <algorithm>
 #include <array>
-#include <tuple>
 #include <ostream>
 #include <optional>
+#include <string_view>
 {% endif %}
 #include <autordf/Object.h>
 
@@ -97,6 +98,45 @@ public:
     {% include "object_property/object_property_declaration.tpl" %}
 
 {% endfor %}
+    /**
+     * @brief Values of all the properties of this interface, read at once by {{ className }}::load()
+     */
+    struct Data {
+        Data();
+        Data(const Data&);
+        Data(Data&&) noexcept;
+        Data& operator=(const Data&);
+        Data& operator=(Data&&) noexcept;
+        ~Data();
+{% for annotationProperty in annotationProperties %}
+
+    {% set property = annotationProperty %}
+    {% include "data_property/data_member_declaration.tpl" %}
+{% endfor %}
+{% for dataProperty in dataProperties %}
+
+    {% set property = dataProperty %}
+    {% include "data_property/data_member_declaration.tpl" %}
+{% endfor %}
+{% for objectProperty in objectProperties %}
+
+    {% set property = objectProperty %}
+    {% include "object_property/data_member_declaration.tpl" %}
+{% endfor %}
+    };
+
+    /**
+     * @brief Fills data with the values of the properties of this interface, as found in snapshot
+     *
+     * @throw PropertyNotFound if a mandatory property is not set
+     */
+    static void loadData(const autordf::PropertySnapshot& snapshot, Data *data);
+
+    /**
+     * @brief Writes the values of the properties of this interface from data, replacing previous values
+     */
+    {{ interfaceName }}& storeData(const Data& data);
+
     /**
      * @brief returns the object this interface object applies to
      */
@@ -115,9 +155,42 @@ public:
 {% if hasOneOf %}
 
 private:
-    typedef std::tuple<Enum, const char *, const char *> EnumArrayEntryType;
-    typedef std::array<EnumArrayEntryType, {{ length(oneOfValues) }}> EnumArrayType;
-    static const EnumArrayType ENUMARRAY;
+    struct EnumArrayEntryType {
+        Enum value;
+        std::string_view iri;
+        std::string_view name;
+    };
+
+    /**
+     * Entries indexed by enum value
+     */
+    static constexpr std::array<EnumArrayEntryType, {{ length(oneOfValues) }}> ENUMARRAY = {{ "{{" }}
+    {% for oneOf in oneOfValues %}
+        { {{ oneOf.name }}, "{{ oneOf.rdfName }}", "{{ oneOf.name }}" },
+    {% endfor %}
+    {{ "}}" }};
+
+    /**
+     * Enum values sorted by IRI, to look IRIs up by binary search
+     */
+    static constexpr std::array<Enum, {{ length(oneOfValues) }}> ENUMS_BY_IRI = {{ "{{" }}
+    {% for oneOf in oneOfValuesByIri %}
+        {{ oneOf.name }},
+    {% endfor %}
+    {{ "}}" }};
+
+    /**
+     * Enum values sorted by name, to look names up by binary search
+     */
+    static constexpr std::array<Enum, {{ length(oneOfValues) }}> ENUMS_BY_NAME = {{ "{{" }}
+    {% for oneOf in oneOfValuesByName %}
+        {{ oneOf.name }},
+    {% endfor %}
+    {{ "}}" }};
+
+    static_assert(std::is_sorted(ENUMS_BY_IRI.begin(), ENUMS_BY_IRI.end(), [](Enum a, Enum b) { return ENUMARRAY[a].iri < ENUMARRAY[b].iri; }));
+    static_assert(std::is_sorted(ENUMS_BY_NAME.begin(), ENUMS_BY_NAME.end(), [](Enum a, Enum b) { return ENUMARRAY[a].name < ENUMARRAY[b].name; }));
+
     static const EnumArrayEntryType& enumVal2Entry(Enum en);
 
 protected:
@@ -4,6 +4,9 @@
 
 // This is auto generated code by AutoRDF, do not edit !
 
+{% if hasOneOf %}
+#include <algorithm>
+{% endif %}
 #include <sstream>
 #include <autordf/Exception.h>
 
@@ -15,43 +18,42 @@
 {% set namespaces = packages %}
 {% include "enter_namespace.tpl" %}
 {% if hasOneOf %}
-const {{ className }}::EnumArrayType {{ interfaceName }}::ENUMARRAY = {
-{
-    {% for oneOf in oneOfValues %}
-    std::make_tuple({{ interfaceName }}::{{ oneOf.name }}, "{{ oneOf.rdfName }}", "{{ oneOf.name }}"),
-    {% endfor %}
-}
-};
-
 const {{ interfaceName }}::EnumArrayEntryType& {{ interfaceName }}::enumVal2Entry(Enum enumVal) {
-    for (auto const& enumItem: ENUMARRAY) {
-        if ( enumVal == std::get<0>(enumItem) ) return enumItem;
+    if ( enumVal < 0 || static_cast<size_t>(enumVal) >= ENUMARRAY.size() ) {
+        std::stringstream ss;
+        ss << "Enum value " << static_cast<int>(enumVal) << " is not valid for for C++ enum {{ className }}";
+        throw autordf::InvalidEnum(ss.str());
     }
-    std::stringstream ss;
-    ss << "Enum value " << enumVal << " is not valid for for C++ enum {{ className }}";
-    throw autordf::InvalidEnum(ss.str());
-};
+    return ENUMARRAY[enumVal];
+}
 
 {{ interfaceName }}::Enum {{ interfaceName }}::asEnum() const {
-    for (auto const& enumItem: ENUMARRAY) {
-        if (object().iri() == std::get<1>(enumItem)) return std::get<0>(enumItem);
+    const std::string_view iri = object().iriView();
+    auto found = std::lower_bound(ENUMS_BY_IRI.begin(), ENUMS_BY_IRI.end(), iri, [](Enum enumVal, std::string_view value) {
+        return ENUMARRAY[enumVal].iri < value;
+    });
+    if ( found == ENUMS_BY_IRI.end() || ENUMARRAY[*found].iri != iri ) {
+        throw autordf::InvalidEnum(std::string(iri) + " is not a valid individual for owl:oneOf type {{ className }}");
     }
-    throw autordf::InvalidEnum(object().iri() + " is not a valid individual for owl:oneOf type {{ className }}");
+    return *found;
 }
 
 std::string {{ interfaceName }}::enumIri(Enum enumVal) {
-    return std::get<1>(enumVal2Entry(enumVal));
+    return std::string(enumVal2Entry(enumVal).iri);
 }
 
 std::string {{ interfaceName }}::enumString(Enum enumVal) {
-    return std::get<2>(enumVal2Entry(enumVal));
+    return std::string(enumVal2Entry(enumVal).name);
 }
 
 {{ interfaceName }}::Enum {{ interfaceName }}::enumFromString(const std::string& enumString) {
-    for (auto const& enumItem: ENUMARRAY) {
-        if (enumString == std::get<2>(enumItem)) return std::get<0>(enumItem);
+    auto found = std::lower_bound(ENUMS_BY_NAME.begin(), ENUMS_BY_NAME.end(), enumString, [](Enum enumVal, const std::string& value) {
+        return ENUMARRAY[enumVal].name < value;
+    });
+    if ( found == ENUMS_BY_NAME.end() || ENUMARRAY[*found].name != enumString ) {
+        throw autordf::InvalidEnum(enumString + " is not a valid individual for owl:oneOf type {{ className }}");
     }
-    throw autordf::InvalidEnum(enumString + " is not a valid individual for owl:oneOf type {{ className }}");
+    return *found;
 }
 {% endif %}
 // This type {{ fullInterfaceName }} has IRI {{ rdfName }}
@@ -72,5 +74,48 @@ const char* {{ interfaceName }}::TYPEIRI = "{{ rdfName }}";
     {% include "object_property/object_property_definition.tpl" %}
 
 {% endfor %}
+{{ interfaceName }}::Data::Data() = default;
+
+{{ interfaceName }}::Data::Data(const Data&) = default;
+
+{{ interfaceName }}::Data::Data(Data&&) noexcept = default;
+
+{{ interfaceName }}::Data& {{ interfaceName }}::Data::operator=(const Data&) = default;
+
+{{ interfaceName }}::Data& {{ interfaceName }}::Data::operator=(Data&&) noexcept = default;
+
+{{ interfaceName }}::Data::~Data() = default;
+
+void {{ interfaceName }}::loadData(const autordf::PropertySnapshot& snapshot, Data *data) {
+{% for annotationProperty in annotationProperties %}
+    {% set property = annotationProperty %}
+    {% include "data_property/data_member_load.tpl" %}
+{% endfor %}
+{% for dataProperty in dataProperties %}
+    {% set property = dataProperty %}
+    {% include "data_property/data_member_load.tpl" %}
+{% endfor %}
+{% for objectProperty in objectProperties %}
+    {% set property = objectProperty %}
+    {% include "object_property/data_member_load.tpl" %}
+{% endfor %}
+}
+
+{{ interfaceName }}& {{ interfaceName }}::storeData(const Data& data) {
+{% for annotationProperty in annotationProperties %}
+    {% set property = annotationProperty %}
+    {% include "data_property/data_member_store.tpl" %}
+{% endfor %}
+{% for dataProperty in dataProperties %}
+    {% set property = dataProperty %}
+    {% include "data_property/data_member_store.tpl" %}
+{% endfor %}
+{% for objectProperty in objectProperties %}
+    {% set property = objectProperty %}
+    {% include "object_property/data_member_store.tpl" %}
+{% endfor %}
+    return *this;
+}
+
 {% include "leave_namespace.tpl" %}
 {% include "leave_internal.tpl" %}
@@ -0,0 +1,8 @@
+        /**
+         * Values of {{ property.fullName }} object property
+         */
+{% if property.maxCardinality <= 1 %}
+        std::shared_ptr<{{ property.class.fullClassName }}> {{ property.name }};
+{% else %}
+        std::vector<{{ property.class.fullClassName }}> {{ property.name }};
+{% endif %}
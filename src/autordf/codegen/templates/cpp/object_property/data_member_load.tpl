@@ -0,0 +1,9 @@
+{% if property.maxCardinality <= 1 %}
+    {% if property.minCardinality > 0 %}
+    data->{{ property.name }} = std::make_shared<{{ property.class.fullClassName }}>(autordf::Object::snapshotObject<{{ property.class.fullClassName }}>(snapshot, {{ property.name }}ObjectPropertyPredicate()));
+    {% else %}
+    data->{{ property.name }} = autordf::Object::snapshotObjectOptional<{{ property.class.fullClassName }}>(snapshot, {{ property.name }}ObjectPropertyPredicate());
+    {% endif %}
+{% else %}
+    data->{{ property.name }} = autordf::Object::snapshotObjectList<{{ property.class.fullClassName }}>(snapshot, {{ property.name }}ObjectPropertyPredicate(), {% if property.ordered %}true{% else %}false{% endif %});
+{% endif %}
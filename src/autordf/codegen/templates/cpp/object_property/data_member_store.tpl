@@ -0,0 +1,9 @@
+{% if property.maxCardinality <= 1 %}
+    if ( data.{{ property.name }} ) {
+        set{{ capitalize(property.name) }}(*data.{{ property.name }});
+    } else {
+        object().setObjectList({{ property.name }}ObjectPropertyPredicate(), {}, false);
+    }
+{% else %}
+    set{{ capitalize(property.name) }}List(data.{{ property.name }});
+{% endif %}
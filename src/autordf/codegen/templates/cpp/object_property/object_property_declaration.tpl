@@ -3,6 +3,11 @@
      */
     static const autordf::Uri {{ property.name }}ObjectPropertyIri;
 
+    /**
+     * Predicate for {{ property.fullName }} object property, built on first call
+     */
+    static const autordf::Predicate& {{ property.name }}ObjectPropertyPredicate();
+
     {% if property.maxCardinality <= 1 %}
         {% if property.minCardinality > 0 %}
             {% set method = property.name %}
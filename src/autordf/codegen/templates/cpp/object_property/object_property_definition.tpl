@@ -1,25 +1,30 @@
 const autordf::Uri {{ interfaceName }}::{{ property.name }}ObjectPropertyIri = "{{ property.rdfName }}";
 
+const autordf::Predicate& {{ interfaceName }}::{{ property.name }}ObjectPropertyPredicate() {
+    static const autordf::Predicate predicate({{ property.name }}ObjectPropertyIri);
+    return predicate;
+}
+
 {% if property.maxCardinality <= 1 %}
     {% if property.minCardinality > 0 %}
 {{ property.class.fullClassName }} {{ interfaceName }}::{{ property.name }}() const {
-    return object().getObject("{{ property.rdfName }}").as<{{ property.class.fullClassName }}>();
+    return object().getObject({{ property.name }}ObjectPropertyPredicate()).as<{{ property.class.fullClassName }}>();
 }
     {% else %}
 std::shared_ptr<{{ property.class.fullClassName }}> {{ interfaceName }}::{{ property.name }}Optional() const {
-    auto result = object().getOptionalObject("{{ property.rdfName }}");
+    auto result = object().getOptionalObject({{ property.name }}ObjectPropertyPredicate());
     return result ? std::make_shared<{{ property.class.fullClassName }}>(*result) : nullptr;
 }
 
 std::optional<{{ property.class.fullClassName }}> {{ interfaceName }}::{{ property.name }}Opt() const {
-    auto result = object().getOptionalObject("{{ property.rdfName }}");
+    auto result = object().getOptionalObject({{ property.name }}ObjectPropertyPredicate());
     return result ? std::make_optional<{{ property.class.fullClassName }}>(static_cast<{{ property.class.fullClassName }}>(*result)) : std::nullopt;
 }
     {% endif %}
 {% endif %}
 {% if property.maxCardinality > 1%}
 std::vector<{{ property.class.fullClassName }}> {{ interfaceName }}::{{ property.name }}List() const {
-    return object().getObjectListImpl<{{ property.class.fullClassName }}>("{{ property.rdfName }}", {% if property.ordered %}true{% else %}false{% endif %});
+    return object().getObjectListImpl<{{ property.class.fullClassName }}>({{ property.name }}ObjectPropertyPredicate(), {% if property.ordered %}true{% else %}false{% endif %});
 }
 
     {% include "setter_for_many_definition.tpl"%}
@@ -1,4 +1,4 @@
 {{ interfaceName }}& {{ interfaceName }}::remove{{ capitalize(property.name) }}(const {{ property.class.fullInterfaceName}}& value) {
-    object().removeObject("{{ property.rdfName }}", value.object());
+    object().removeObject({{ property.name }}ObjectPropertyPredicate(), value.object());
     return *this;
 }
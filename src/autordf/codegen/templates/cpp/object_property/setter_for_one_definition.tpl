@@ -1,4 +1,4 @@
 {{ interfaceName }}& {{ interfaceName }}::set{{ capitalize(property.name) }}(const {{ property.class.fullInterfaceName }}& value) {
-    object().setObject("{{ property.rdfName }}", value.object());
+    object().setObject({{ property.name }}ObjectPropertyPredicate(), value.object());
     return *this;
 }
@@ -10,6 +10,11 @@ from {{ ancestor.fullInterfaceName }} import {{ ancestor.interfaceName }}
 {% set comment = classComment %}
 {% include "comment.tpl" %}
 class {{ className }}({% for ancestor in ancestors %}{{ ancestor.interfaceName }}, {% endfor %}{{ interfaceName }}, autordf_py.Object):
+    __slots__ = ()
+
+    # Fields read by loadAll(), gathered from all interfaces on first call.
+    # Shared by all threads without a lock: they hold the GIL, and at worst compute the same columns twice
+    _loadColumns = None
 
     """
     @brief Creates new object
@@ -43,7 +48,24 @@ class {{ className }}({% for ancestor in ancestors %}{{ ancestor.interfaceName }
     """
     @staticmethod
     def find():
-        return [{{ className }}(other=found) for found in autordf_py.Object.findByType({{ interfaceName }}.TYPEIRI)]
+        return autordf_py.Object.findByTypeAs({{ interfaceName }}.TYPEIRI, {{ className }})
+
+    """
+    @brief Reads the values of all the properties of this object, with a single query
+    @return a dict from property name to its value or None for single valued properties, or to the list of its values
+    @throw CannotPreserveOrder if an ordered property values were not written with ordering
+    """
+    def loadAll(self):
+        if {{ className }}._loadColumns is None:
+            fields = []
+{% for ancestor in ancestors %}
+            fields += {{ ancestor.interfaceName }}._loadFields()
+{% endfor %}
+            fields += {{ interfaceName }}._loadFields()
+            {{ className }}._loadColumns = [list(column) for column in zip(*fields)] if fields else [[], [], [], [], []]
+        names, predicates, ordered, single, classes = {{ className }}._loadColumns
+        lists = self.getValueLists(predicates, ordered, classes)
+        return {name: (values[0] if values else None) if one else values for name, values, one in zip(names, lists, single)}
 {% for annotationKey in annotationKeys %}
     {% set key = annotationKey %}
     {% include "data_property/key.tpl" %}
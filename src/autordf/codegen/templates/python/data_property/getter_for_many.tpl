@@ -3,4 +3,4 @@
 {% set comment.return = "the list of values. List can be empty if not values are set in database" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self):
-        return self.getPropertyValueList("{{ property.rdfName }}", {% if property.ordered %}True{% else %}False{% endif %})
+        return self.getPropertyValueList(_{{ property.name }}DataPredicate, {% if property.ordered %}True{% else %}False{% endif %})
@@ -4,4 +4,4 @@
 {% set comment.throw = "PropertyNotFound if value is not set in database" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self):
-        return self.getPropertyValue("{{ property.rdfName }}")
+        return self.getPropertyValue(_{{ property.name }}DataPredicate)
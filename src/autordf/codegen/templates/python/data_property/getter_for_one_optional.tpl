@@ -3,7 +3,7 @@
 {% set comment.return = "the value if it is set, or None if it is not set." %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self):
-        return self.getOptionalPropertyValue("{{ property.rdfName }}")
+        return self.getOptionalPropertyValue(_{{ property.name }}DataPredicate)
 
 
 {% set method = concat("get", capitalize(property.name)) %}
@@ -11,5 +11,5 @@
 {% set comment.return = "the value if it is set, or defaultval if it is not set." %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, defaultval):
-        ptr = self.getOptionalPropertyValue("{{ property.rdfName }}")
+        ptr = self.getOptionalPropertyValue(_{{ property.name }}DataPredicate)
         return autordf_py.PropertyValue(defaultval) if ptr == None else ptr
@@ -5,5 +5,5 @@
 {% set comment.throw = "PropertyNotFound if propertyIRI has not obj as value" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, value):
-        self.removePropertyValue("{{ property.rdfName }}", value)
+        self.removePropertyValue(_{{ property.name }}DataPredicate, value)
         return self
@@ -4,7 +4,7 @@
 {% set comment.param = "values the list of values" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, values):
-        self.setPropertyValueList("{{ property.rdfName }}", values, {% if property.ordered %}True{% else %}False{% endif %})
+        self.setPropertyValueList(_{{ property.name }}DataPredicate, values, {% if property.ordered %}True{% else %}False{% endif %})
         return self
 
 {% set method = concat("add", capitalize(property.name)) %}
@@ -13,5 +13,5 @@
 {% set comment.param = "value the value to add" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, value):
-        self.addPropertyValue("{{ property.rdfName }}", value, {% if property.ordered %}True{% else %}False{% endif %})
+        self.addPropertyValue(_{{ property.name }}DataPredicate, value, {% if property.ordered %}True{% else %}False{% endif %})
         return self
@@ -4,5 +4,5 @@
 {% set comment.param = "value value to set for this property, removing all other values" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, value):
-        self.setPropertyValue("{{ property.rdfName }}", value)
+        self.setPropertyValue(_{{ property.name }}DataPredicate, value)
         return self
@@ -6,8 +6,20 @@ import autordf_py
 from enum import Enum
 {% endif %}
 
+# Predicates are built once, when the module is loaded, rather than on each property access
+{% for annotationProperty in annotationProperties %}
+_{{ annotationProperty.name }}DataPredicate = autordf_py.Predicate("{{ annotationProperty.rdfName }}")
+{% endfor %}
+{% for dataProperty in dataProperties %}
+_{{ dataProperty.name }}DataPredicate = autordf_py.Predicate("{{ dataProperty.rdfName }}")
+{% endfor %}
+{% for objectProperty in objectProperties %}
+_{{ objectProperty.name }}ObjectPredicate = autordf_py.Predicate("{{ objectProperty.rdfName }}")
+{% endfor %}
 
 class {{ interfaceName }}(autordf_py.Object):
+    # Instances have no __dict__: state is held by the underlying autordf_py.Object
+    __slots__ = ()
 
 {% if hasOneOf %}
     """
@@ -90,6 +102,30 @@ class {{ interfaceName }}(autordf_py.Object):
     """This type {{ fullInterfaceName }} has IRI {{ rdfName }}"""
     TYPEIRI = "{{ rdfName }}"
 
+    """
+    @brief Properties of this type read by loadAll()
+    @return a list of (property name, predicate, ordered, single valued, class of values or None for data properties)
+    """
+    @staticmethod
+    def _loadFields():
+{% if length(objectProperties) > 0 %}
+        from {{ fullClassName }} import {{ className }}
+{% endif %}
+{% for dependency in dependencies %}
+        from {{ dependency.fullClassName }} import {{ dependency.className }}
+{% endfor %}
+        return [
+{% for annotationProperty in annotationProperties %}
+            ("{{ annotationProperty.name }}", _{{ annotationProperty.name }}DataPredicate, {% if annotationProperty.ordered %}True{% else %}False{% endif %}, {% if annotationProperty.maxCardinality <= 1 %}True{% else %}False{% endif %}, None),
+{% endfor %}
+{% for dataProperty in dataProperties %}
+            ("{{ dataProperty.name }}", _{{ dataProperty.name }}DataPredicate, {% if dataProperty.ordered %}True{% else %}False{% endif %}, {% if dataProperty.maxCardinality <= 1 %}True{% else %}False{% endif %}, None),
+{% endfor %}
+{% for objectProperty in objectProperties %}
+            ("{{ objectProperty.name }}", _{{ objectProperty.name }}ObjectPredicate, {% if objectProperty.ordered %}True{% else %}False{% endif %}, {% if objectProperty.maxCardinality <= 1 %}True{% else %}False{% endif %}, {{ objectProperty.class.className }}),
+{% endfor %}
+        ]
+
 {% for annotationProperty in annotationProperties %}
     {% set property = annotationProperty %}
     {% include "data_property/data_property.tpl" %}
@@ -4,4 +4,4 @@
 {% include "../property_comment.tpl" %}
     def {{ method}}(self):
         from {{ property.class.fullClassName }} import {{ property.class.className }}
-        return [{{ property.class.className }}(other=elem) for elem in self.getObjectList("{{ property.rdfName }}", {% if property.ordered %}True{% else %}False{% endif %})]
+        return self.getObjectListAs(_{{ property.name }}ObjectPredicate, {{ property.class.className }}, {% if property.ordered %}True{% else %}False{% endif %})
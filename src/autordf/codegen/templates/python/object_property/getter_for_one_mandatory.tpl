@@ -5,4 +5,4 @@
 {% include "../property_comment.tpl" %}
     def {{ method }}(self):
         from {{ property.class.fullClassName }} import {{ property.class.className }}
-        return {{ property.class.className }}(other=self.getObject("{{ property.rdfName }}"))
+        return {{ property.class.className }}(other=self.getObject(_{{ property.name }}ObjectPredicate))
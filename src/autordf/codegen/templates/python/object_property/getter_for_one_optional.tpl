@@ -4,5 +4,5 @@
 {% include "../property_comment.tpl" %}
     def {{ method }}(self):
         from {{ property.class.fullClassName }} import {{ property.class.className }}
-        opt = self.getOptionalObject("{{ property.name }}")
-        return None if opt == None else {{ property.class.fullClassName }}(other=opt)
+        opt = self.getOptionalObject(_{{ property.name }}ObjectPredicate)
+        return None if opt == None else {{ property.class.className }}(other=opt)
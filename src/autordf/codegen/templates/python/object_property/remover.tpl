@@ -5,5 +5,5 @@
 {% set comment.throw = "PropertyNotFound if propertyIRI has not obj as value" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, value):
-        self.removeObject("{{ property.rdfName }}", value)
+        self.removeObject(_{{ property.name }}ObjectPredicate, value)
         return self
@@ -4,7 +4,7 @@
 {% set comment.param = "values values to set for this property" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, values):
-        self.setObjectList("{{ property.rdfName }}", values, {% if property.ordered %}True{% else %}False{% endif %})
+        self.setObjectList(_{{ property.name }}ObjectPredicate, values, {% if property.ordered %}True{% else %}False{% endif %})
         return self
 
 {% set method = concat("add", capitalize(property.name)) %}
@@ -13,5 +13,5 @@
 {% set comment.param = "value value to set for this property, removing all other values" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, value):
-        self.addObject("{{ property.rdfName }}", value, {% if property.ordered %}True{% else %}False{% endif %})
+        self.addObject(_{{ property.name }}ObjectPredicate, value, {% if property.ordered %}True{% else %}False{% endif %})
         return self
@@ -4,5 +4,5 @@
 {% set comment.param = "value value to set for this property, removing all other values" %}
 {% include "../property_comment.tpl" %}
     def {{ method }}(self, value):
-        self.setObject("{{ property.rdfName }}", value)
+        self.setObject(_{{ property.name }}ObjectPredicate, value)
         return self
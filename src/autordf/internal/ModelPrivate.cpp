@@ -1,5 +1,8 @@
 #include "autordf/internal/ModelPrivate.h"
 
+#include <algorithm>
+
+#include "autordf/internal/Stream.h"
 #include "autordf/internal/World.h"
 #include "autordf/Storage.h"
 #include "autordf/Exception.h"
@@ -21,9 +24,9 @@ ModelPrivate::~ModelPrivate() {
     _model = 0;
 }
 #elif defined(USE_SORD)
-ModelPrivate::ModelPrivate() {
+ModelPrivate::ModelPrivate(bool graphIndexes) : _graphIndexes(graphIndexes) {
     /* Default storage type, which is memory */
-    _model = sord_new(World().get(), 0xFF, false);
+    _model = sord_new(World().get(), 0xFF, graphIndexes);
     if (!_model) {
         throw InternalError("Failed to create RDF model");
     }
@@ -35,5 +38,23 @@ ModelPrivate::~ModelPrivate() {
 }
 #endif
 
+void ModelPrivate::changed() {
+    ++_revision;
+    for ( const std::weak_ptr<Stream>& cursorStream : _cursorStreams ) {
+        if ( std::shared_ptr<Stream> stream = cursorStream.lock() ) {
+            stream->close();
+        }
+    }
+    _cursorStreams.clear();
+}
+
+void ModelPrivate::addCursorStream(const std::shared_ptr<Stream>& stream) {
+    // Forgets the streams of cursors already gone, so that the list does not grow while the model is only read
+    _cursorStreams.erase(std::remove_if(_cursorStreams.begin(), _cursorStreams.end(), [](const std::weak_ptr<Stream>& cursorStream) {
+        return cursorStream.expired();
+    }), _cursorStreams.end());
+    _cursorStreams.push_back(stream);
+}
+
 }
 }
@@ -2,6 +2,7 @@
 #define AUTORDF_MODELPRIVATE_H
 
 #include <memory>
+#include <vector>
 #include <autordf/internal/cAPI.h>
 
 namespace autordf {
@@ -10,22 +11,51 @@ class Storage;
 
 namespace internal {
 
+class Stream;
+
 class ModelPrivate {
 public:
 #if defined(USE_REDLAND)
     ModelPrivate(std::shared_ptr<Storage> storage);
 #elif defined(USE_SORD)
-    ModelPrivate();
+    /**
+     * @param graphIndexes also index statements by graph first, for graph scoped queries
+     */
+    explicit ModelPrivate(bool graphIndexes = false);
 #endif
 
     ~ModelPrivate();
 
     c_api_model *get() const { return _model; }
 
+    /**
+     * Increased at each change of the model, so that cursors can detect they are not valid anymore
+     */
+    unsigned long revision() const { return _revision; }
+
+    /**
+     * To be called before each change of the model. Cursors are invalidated, and the storage iterators they
+     * hold are freed: Sord does not allow to change a model while an iterator on it is alive
+     */
+    void changed();
+
+    /**
+     * Registers the stream of a cursor, closed at next change
+     */
+    void addCursorStream(const std::shared_ptr<Stream>& stream);
+
+#if defined(USE_SORD)
+    bool graphIndexes() const { return _graphIndexes; }
+#endif
+
 private:
     c_api_model *_model;
+    unsigned long _revision = 0;
+    std::vector<std::weak_ptr<Stream> > _cursorStreams;
 #if defined(USE_REDLAND)
     std::shared_ptr<Storage> _storage;
+#elif defined(USE_SORD)
+    bool _graphIndexes;
 #endif
 };
 
@@ -0,0 +1,72 @@
+#include "autordf/internal/NamespaceIndex.h"
+
+#include <algorithm>
+
+namespace autordf {
+namespace internal {
+
+namespace {
+bool charLess(const std::pair<char, std::uint32_t>& child, char c) {
+    return child.first < c;
+}
+}
+
+NamespaceIndex::NamespaceIndex() : _nodes(1) {
+}
+
+void NamespaceIndex::add(const std::string& prefix, const std::string& ns) {
+    auto inserted = _prefixes.emplace(ns, prefix);
+    if ( !inserted.second ) {
+        if ( prefix < inserted.first->second ) {
+            inserted.first->second = prefix;
+        }
+        return;
+    }
+
+    std::uint32_t node = 0;
+    for ( char c : ns ) {
+        std::vector<std::pair<char, std::uint32_t>>& children = _nodes[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), c, charLess);
+        if ( it != children.end() && it->first == c ) {
+            node = it->second;
+        } else {
+            std::uint32_t newNode = static_cast<std::uint32_t>(_nodes.size());
+            children.emplace(it, c, newNode);
+            // children is not used past this point: emplace_back may reallocate _nodes
+            _nodes.emplace_back();
+            node = newNode;
+        }
+    }
+    _nodes[node].prefix = &inserted.first->second;
+}
+
+const std::string* NamespaceIndex::prefix(const std::string& ns) const {
+    auto it = _prefixes.find(ns);
+    return it != _prefixes.end() ? &it->second : nullptr;
+}
+
+const std::string* NamespaceIndex::longestMatch(const std::string& iri, std::string::size_type *length) const {
+    const std::string *best = _nodes[0].prefix;
+    *length = 0;
+    std::uint32_t node = 0;
+    for ( std::string::size_type i = 0; i < iri.length(); ++i ) {
+        node = child(node, iri[i]);
+        if ( !node ) {
+            break;
+        }
+        if ( _nodes[node].prefix ) {
+            best = _nodes[node].prefix;
+            *length = i + 1;
+        }
+    }
+    return best;
+}
+
+std::uint32_t NamespaceIndex::child(std::uint32_t node, char c) const {
+    const std::vector<std::pair<char, std::uint32_t>>& children = _nodes[node].children;
+    auto it = std::lower_bound(children.begin(), children.end(), c, charLess);
+    return it != children.end() && it->first == c ? it->second : 0;
+}
+
+}
+}
@@ -0,0 +1,63 @@
+#ifndef AUTORDF_NAMESPACEINDEX_H
+#define AUTORDF_NAMESPACEINDEX_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autordf {
+namespace internal {
+
+/**
+ * Namespace --> prefix lookups, whatever the number of registered namespaces:
+ * - prefix of an exact namespace, through a hash
+ * - longest namespace an IRI starts with, through a trie walked once along the IRI
+ *
+ * When several prefixes are registered for a namespace, the alphabetically first one is used, as the
+ * prefix --> namespace map of Model is ordered that way
+ */
+class NamespaceIndex {
+public:
+    NamespaceIndex();
+
+    /**
+     * Registers prefix for namespace
+     */
+    void add(const std::string& prefix, const std::string& ns);
+
+    /**
+     * Prefix registered for ns, nullptr if none
+     */
+    const std::string* prefix(const std::string& ns) const;
+
+    /**
+     * Finds the longest registered namespace iri starts with
+     * @param length set to the length of that namespace
+     * @return its prefix, nullptr if no namespace matches
+     */
+    const std::string* longestMatch(const std::string& iri, std::string::size_type *length) const;
+
+private:
+    struct TrieNode {
+        /** Sorted by char */
+        std::vector<std::pair<char, std::uint32_t>> children;
+        /** Prefix of the namespace ending at this node, nullptr if none */
+        const std::string *prefix = nullptr;
+    };
+
+    std::vector<TrieNode> _nodes;
+    // Values never move: trie nodes point to them
+    std::unordered_map<std::string, std::string> _prefixes;
+
+    /**
+     * Index of child of node for c, 0 if none (root is never a child)
+     */
+    std::uint32_t child(std::uint32_t node, char c) const;
+};
+
+}
+}
+
+#endif //AUTORDF_NAMESPACEINDEX_H
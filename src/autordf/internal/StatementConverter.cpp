@@ -52,6 +52,9 @@ void StatementConverter::toCAPIStatement(const Statement *stmt, SordQuad *cstmt)
     if (!stmt->object.empty()) {
         (*cstmt)[SordQuadIndex::SORD_OBJECT] = stmt->object.get();
     }
+    if (!stmt->graph.empty()) {
+        (*cstmt)[SordQuadIndex::SORD_GRAPH] = stmt->graph.get();
+    }
 }
 
 std::shared_ptr<Statement> StatementConverter::fromCAPIStatement(SordQuad *cstmt) {
@@ -61,7 +64,8 @@ std::shared_ptr<Statement> StatementConverter::fromCAPIStatement(SordQuad *cstmt
                 // Node copy constructor is called in order to create a Node copy that won't be won by sord
                 Node(Node(const_cast<SordNode*>((*cstmt)[SordQuadIndex::SORD_SUBJECT]), false)),
                 Node(Node(const_cast<SordNode*>((*cstmt)[SordQuadIndex::SORD_PREDICATE]), false)),
-                Node(Node(const_cast<SordNode*>((*cstmt)[SordQuadIndex::SORD_OBJECT]), false)));
+                Node(Node(const_cast<SordNode*>((*cstmt)[SordQuadIndex::SORD_OBJECT]), false)),
+                Node(Node(const_cast<SordNode*>((*cstmt)[SordQuadIndex::SORD_GRAPH]), false)));
     } else {
         return std::make_shared<Statement>();
     }
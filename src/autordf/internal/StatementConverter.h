@@ -13,7 +13,7 @@ namespace internal {
 class StatementConverter {
 public:
     /**
-     * Once called ours is emptyed
+     * Once called ours is emptyed, except for Redland its graph, which librdf statements do not hold
      */
 #if defined(USE_REDLAND)
     static std::shared_ptr<c_api_statement> toCAPIStatement(Statement *ours);
@@ -8,8 +8,12 @@ namespace internal {
 Stream::Stream(c_api_stream* stream) : _stream(stream) {
 }
 
-#ifdef USE_REDLAND
 Stream::~Stream() {
+    close();
+}
+
+#ifdef USE_REDLAND
+void Stream::close() {
     if (_stream) {
         librdf_free_stream(_stream);
         _stream = nullptr;
@@ -17,7 +21,10 @@ Stream::~Stream() {
 }
 
 std::shared_ptr<Statement> Stream::getObject() {
-    return StatementConverter::fromCAPIStatement(librdf_stream_get_object(_stream));
+    std::shared_ptr<Statement> stmt = StatementConverter::fromCAPIStatement(librdf_stream_get_object(_stream));
+    // librdf statements have no graph, the stream knows it
+    stmt->graph = Node(librdf_stream_get_context2(_stream), false);
+    return stmt;
 }
 
 /** Returns false if stream finished */
@@ -31,7 +38,7 @@ bool Stream::end() {
 }
 
 #elif USE_SORD
-Stream::~Stream() {
+void Stream::close() {
     if (_stream) {
         sord_iter_free(_stream);
         _stream = nullptr;
@@ -26,6 +26,9 @@ public:
 
     c_api_stream* get() const { return _stream; }
 
+    /** Frees underlying stream: stream is then at end */
+    void close();
+
 private:
     c_api_stream* _stream;
 };
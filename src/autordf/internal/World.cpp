@@ -1,9 +1,11 @@
 #include "autordf/internal/cAPI.h"
 #include "autordf/internal/World.h"
 
+#include <algorithm>
+#include <charconv>
 #include <cstdio>
 #include <cstdlib>
-#include <sstream>
+#include <cstring>
 #include <iostream>
 
 #include <boost/date_time.hpp>
@@ -51,13 +53,23 @@ World::~World() {
     }
 }
 
-std::string World::genUniqueId() const {
+std::string World::genUniqueId() {
     unsigned char * genid = librdf_world_get_genid(_world);
     std::string id = reinterpret_cast<const char *>(genid);
     free(genid);
     return id;
 }
 
+size_t World::genUniqueId(char *buf, size_t size) {
+    // librdf only hands out allocated ids
+    unsigned char * genid = librdf_world_get_genid(_world);
+    size_t len = std::min(strlen(reinterpret_cast<const char *>(genid)), size - 1);
+    memcpy(buf, genid, len);
+    buf[len] = 0;
+    free(genid);
+    return len;
+}
+
 int World::logCB(void*, librdf_log_message* message) {
     raptor_locator *locator = (raptor_locator*)(message->locator);
 
@@ -93,7 +105,7 @@ int World::logCB(void*, librdf_log_message* message) {
 #elif defined(USE_SORD)
 
 unsigned long World::_genIdBase;
-unsigned long World::_genIdCtr;
+std::atomic<unsigned long> World::_genIdCtr;
 
 World::World() {
     using namespace boost::gregorian;
@@ -133,6 +145,11 @@ SerdStatus World::sordErrorCB(void*, const SerdError* error) {
 }
 
 std::string World::genUniqueId() {
+    char id[UNIQUE_ID_MAX_SIZE];
+    return std::string(id, genUniqueId(id, sizeof(id)));
+}
+
+size_t World::genUniqueId(char *buf, size_t size) {
 // boost/process/environment.hpp generates too many errors on WINRT and isn't available until boost 1.64
 // so use POSIX / Windows methods instead of boost::this_process::get_id()
 #ifdef WIN32
@@ -140,9 +157,22 @@ std::string World::genUniqueId() {
 #else
     pid_t pid = getpid();
 #endif
-    std::stringstream id;
-    id << 'B' << _genIdBase << 'b' << pid << 'b' << ++_genIdCtr;
-    return id.str();
+    // B<time base>b<pid>b<counter>, formatted on the stack: this runs for each blank node of parsed files
+    // Three 64 bits numbers and three separators always fit, keeping room for each separator
+    static_assert(UNIQUE_ID_MAX_SIZE > 3 * (20 + 1));
+    char id[UNIQUE_ID_MAX_SIZE];
+    char *end = id + sizeof(id) - 1;
+    char *p = id;
+    *p++ = 'B';
+    p = std::to_chars(p, end, _genIdBase).ptr;
+    *p++ = 'b';
+    p = std::to_chars(p, end, pid).ptr;
+    *p++ = 'b';
+    p = std::to_chars(p, end, _genIdCtr.fetch_add(1, std::memory_order_relaxed) + 1).ptr;
+    size_t len = std::min(static_cast<size_t>(p - id), size - 1);
+    memcpy(buf, id, len);
+    buf[len] = 0;
+    return len;
 }
 
 #endif
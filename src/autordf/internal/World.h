@@ -1,6 +1,8 @@
 #ifndef AUTORDF_WORLD_H
 #define AUTORDF_WORLD_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdio>
 #include <mutex>
 #include <string>
@@ -24,6 +26,11 @@ public:
 
     c_api_world* get() const { return _world; }
 
+    /**
+     * Size of a buffer large enough for any id returned by genUniqueId(), trailing nul included
+     */
+    static constexpr size_t UNIQUE_ID_MAX_SIZE = 64;
+
     /**
      * Generates a new, unique, id
      * Can be used as blank node id
@@ -31,6 +38,13 @@ public:
      */
     static std::string genUniqueId();
 
+    /**
+     * Same as above, without any allocation. Thread safe
+     * @param buf receives the nul terminated id, truncated if size is lower than UNIQUE_ID_MAX_SIZE
+     * @return id length
+     */
+    static size_t genUniqueId(char *buf, size_t size);
+
 private:
     static std::mutex _mutex;
     static c_api_world* _world;
@@ -40,7 +54,7 @@ private:
 #endif
 #if defined(USE_SORD)
     static unsigned long _genIdBase;
-    static unsigned long _genIdCtr;
+    static std::atomic<unsigned long> _genIdCtr;
     static SerdStatus sordErrorCB(void* handle, const SerdError* error);
 #endif
 };
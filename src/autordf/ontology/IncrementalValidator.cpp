@@ -0,0 +1,140 @@
+#include "autordf/ontology/IncrementalValidator.h"
+
+namespace autordf {
+namespace ontology {
+namespace validation {
+
+IncrementalValidator::IncrementalValidator(const Ontology& ontology, const ValidationOption& option) :
+    _ontology(ontology), _option(option) {
+}
+
+void IncrementalValidator::added(const Statement& stmt) {
+    record(stmt);
+}
+
+void IncrementalValidator::removed(const Statement& stmt) {
+    record(stmt);
+}
+
+void IncrementalValidator::aggregationFinished() {
+    // Validation is run on demand by revalidate(), not after each modification
+}
+
+void IncrementalValidator::record(const Statement& stmt) {
+    Object subject = Object::createFromNode(stmt.subject);
+    _touchedSubjects.insert(subject);
+    if ( Object::RDF_TYPE == stmt.predicate.iri() ) {
+        _retypedSubjects.insert(subject);
+        if ( stmt.object.type() == NodeType::RESOURCE ) {
+            _touchedClasses.insert(stmt.object.iri());
+        }
+    } else if ( Object::RDF_SUBJECT == stmt.predicate.iri() && stmt.object.type() != NodeType::LITERAL ) {
+        // Reified statement: values of the object it refers to changed
+        _touchedSubjects.insert(Object::createFromNode(stmt.object));
+    }
+}
+
+const Error::Vec& IncrementalValidator::validateAll() {
+    _touchedSubjects.clear();
+    _retypedSubjects.clear();
+    _touchedClasses.clear();
+    _objectErrors.clear();
+    _keyErrors.clear();
+
+    std::set<Object> objects;
+    std::set<std::string> classes;
+    for ( const auto& uriKlass: _ontology.classUri2Ptr() ) {
+        for ( const Object& object: Object::findByType(uriKlass.first) ) {
+            objects.insert(object);
+        }
+        classes.insert(uriKlass.first);
+    }
+    _touchedSubjects = std::move(objects);
+    _touchedClasses = std::move(classes);
+    return revalidate();
+}
+
+const Error::Vec& IncrementalValidator::revalidate() {
+    std::set<Object> subjects;
+    subjects.swap(_touchedSubjects);
+    std::set<std::string> classes;
+    classes.swap(_touchedClasses);
+
+    // Whoever points to a retyped resource may not satisfy its range anymore
+    for ( const Object& retyped: _retypedSubjects ) {
+        std::set<Object> sources = retyped.findSources();
+        subjects.insert(sources.begin(), sources.end());
+    }
+    _retypedSubjects.clear();
+
+    // Modifying a reified statement changes the values of the object it refers to
+    std::set<Object> reifiedSubjects;
+    for ( const Object& subject: subjects ) {
+        std::optional<Object> reifiedSubject = subject.getOptionalObject(Object::RDF_SUBJECT);
+        if ( reifiedSubject ) {
+            reifiedSubjects.insert(*reifiedSubject);
+        }
+    }
+    subjects.insert(reifiedSubjects.begin(), reifiedSubjects.end());
+
+    // Keys are checked class by class, not object by object
+    ValidationOption objectOption(_option);
+    objectOption.enforceObjectKeyUniqueness = false;
+
+    for ( const Object& subject: subjects ) {
+        Error::Vec objectErrors = validateObject(_ontology, subject, objectOption);
+        if ( objectErrors.empty() ) {
+            _objectErrors.erase(subject);
+        } else {
+            _objectErrors[subject] = std::move(objectErrors);
+        }
+        if ( _option.enforceObjectKeyUniqueness ) {
+            collectClasses(subject, &classes);
+        }
+    }
+
+    if ( _option.enforceObjectKeyUniqueness ) {
+        validateClassesKeys(classes);
+    }
+
+    rebuildErrors();
+    return _errors;
+}
+
+void IncrementalValidator::collectClasses(const Object& object, std::set<std::string> *classes) const {
+    for ( const Uri& type: object.getTypes(_ontology.model()->baseUri()) ) {
+        if ( _ontology.containsClass(type) ) {
+            for ( const ValidationPlan::Segment& segment: _ontology.validationPlan(type).segments() ) {
+                classes->insert(segment.klass->rdfname());
+            }
+        }
+    }
+}
+
+void IncrementalValidator::validateClassesKeys(const std::set<std::string>& classes) {
+    for ( const std::string& klassIri: classes ) {
+        if ( !_ontology.containsClass(klassIri) ) {
+            continue;
+        }
+        Error::Vec keyErrors = validateKeys(_ontology, *_ontology.findClass(klassIri));
+        if ( keyErrors.empty() ) {
+            _keyErrors.erase(klassIri);
+        } else {
+            _keyErrors[klassIri] = std::move(keyErrors);
+        }
+    }
+}
+
+void IncrementalValidator::rebuildErrors() {
+    _errors.clear();
+    for ( const auto& objectErrors: _objectErrors ) {
+        _errors.insert(_errors.end(), objectErrors.second.begin(), objectErrors.second.end());
+    }
+    for ( const auto& keyErrors: _keyErrors ) {
+        _errors.insert(_errors.end(), keyErrors.second.begin(), keyErrors.second.end());
+    }
+}
+
+}
+}
+}
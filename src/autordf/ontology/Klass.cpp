@@ -20,54 +20,33 @@ std::set <std::shared_ptr<Klass> > Klass::ancestors() {
     return s;
 }
 
-std::set <std::shared_ptr<const Klass> > Klass::predecessors() const {
-    std::set<std::shared_ptr<const Klass> > predecessors;
-    for ( auto uriKlass : _ontology->classUri2Ptr()) {
-        for (auto ancestor = uriKlass.second->_directAncestors.begin(); ancestor != uriKlass.second->_directAncestors.end(); ++ancestor ) {
-            if (rdfname() == *ancestor) {
-                predecessors.insert(uriKlass.second);
-                break;
-            }
-        }
+namespace {
+/**
+ * Converts a set of class indexes to the set of classes
+ */
+template<typename KlassPtr> std::set<KlassPtr> classesFromMask(const Ontology* ontology, const boost::dynamic_bitset<>& mask) {
+    std::set<KlassPtr> classes;
+    for ( size_t index = mask.find_first(); index != boost::dynamic_bitset<>::npos; index = mask.find_next(index) ) {
+        classes.insert(ontology->classAt(index));
     }
-    return predecessors;
+    return classes;
+}
+}
+
+std::set <std::shared_ptr<const Klass> > Klass::predecessors() const {
+    return classesFromMask<std::shared_ptr<const Klass> >(_ontology, _directPredecessors);
 }
 
 std::set <std::shared_ptr<Klass> > Klass::predecessors() {
-    std::set<std::shared_ptr<Klass> > predecessors;
-    for ( auto uriKlass : _ontology->classUri2Ptr()) {
-        for (auto ancestor = uriKlass.second->_directAncestors.begin(); ancestor != uriKlass.second->_directAncestors.end(); ++ancestor ) {
-            if (rdfname() == *ancestor) {
-                predecessors.insert(uriKlass.second);
-                break;
-            }
-        }
-    }
-    return predecessors;
+    return classesFromMask<std::shared_ptr<Klass> >(_ontology, _directPredecessors);
 }
 
 std::set<std::shared_ptr<const Klass> > Klass::getAllAncestors() const {
-    std::set<std::shared_ptr<const Klass> > all;
-    for ( auto ancestor = _directAncestors.begin(); ancestor != _directAncestors.end(); ++ancestor ) {
-        all.insert(_ontology->classUri2Ptr().at(*ancestor));
-        for ( std::shared_ptr<const Klass> more : _ontology->classUri2Ptr().at(*ancestor)->getAllAncestors() ) {
-            all.insert(more);
-        }
-    }
-    return all;
+    return classesFromMask<std::shared_ptr<const Klass> >(_ontology, _allAncestors);
 }
 
 std::set<std::shared_ptr<const Klass> > Klass::getAllPredecessors() const {
-    std::set<std::shared_ptr<const Klass> > all;
-    for ( auto predecessor : predecessors() ) {
-        all.insert(predecessor);
-        for ( std::shared_ptr<const Klass> more : predecessor->getAllPredecessors() ) {
-            all.insert(more);
-        }
-    }
-    return all;
+    return classesFromMask<std::shared_ptr<const Klass> >(_ontology, _allPredecessors);
 }
 }
 }
-
-
@@ -1,8 +1,16 @@
 #include "autordf/ontology/Ontology.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <ostream>
+
 #include "autordf/Factory.h"
 #include "autordf/Object.h"
 #include "autordf/ontology/RdfsEntity.h"
+#include "SchemaIndex.h"
 
 namespace autordf {
 
@@ -15,6 +23,8 @@ const std::string Ontology::AUTORDF_NS  = "http://github.com/ariadnext/AutoRDF#"
 
 Ontology::Ontology(const Factory* f, bool verbose) : _verbose(verbose), _f(f) {
     populateSchemaClasses(f);
+    computeClassHierarchy();
+    buildValidationPlans();
 }
 
 const Model* Ontology::model() const {
@@ -24,6 +34,9 @@ const Model* Ontology::model() const {
 void Ontology::populateSchemaClasses(const Factory *f) {
     autordf::Object::setFactory(const_cast<Factory*>(f)) ;
 
+    // Schema triples are read in one go, extraction below only hits this index
+    const SchemaIndex index(*f);
+
     // BEGIN Add well known classes //
     auto owlThing = std::make_shared<Klass>(this);
     owlThing->_rdfname = OWL_NS + "Thing";
@@ -36,53 +49,50 @@ void Ontology::populateSchemaClasses(const Factory *f) {
     rdfsResource->_directAncestors.insert(owlThing->_rdfname);
     addClass(rdfsResource);
 
-    addHardcodedAnnotationProperty(OWL_NS  + "versionInfo", "Provides basic information for version control purpose");
-    addHardcodedAnnotationProperty(RDFS_NS + "label",       "Supports a natural language label for the resource/property");
-    addHardcodedAnnotationProperty(RDFS_NS + "comment",     "Supports a natural language comment about a resource/property");
-    addHardcodedAnnotationProperty(RDFS_NS + "seeAlso",     "Provides a way to identify more information about the resource");
-    addHardcodedAnnotationProperty(RDFS_NS + "isDefinedBy", "Provides a link pointing to the source of information about the resource");
+    addHardcodedAnnotationProperty(index, OWL_NS  + "versionInfo", "Provides basic information for version control purpose");
+    addHardcodedAnnotationProperty(index, RDFS_NS + "label",       "Supports a natural language label for the resource/property");
+    addHardcodedAnnotationProperty(index, RDFS_NS + "comment",     "Supports a natural language comment about a resource/property");
+    addHardcodedAnnotationProperty(index, RDFS_NS + "seeAlso",     "Provides a way to identify more information about the resource");
+    addHardcodedAnnotationProperty(index, RDFS_NS + "isDefinedBy", "Provides a link pointing to the source of information about the resource");
 
     // END Add well known classes //
 
     // Gather annotation Properties
-    const std::vector<Object>& owlAnnotationProperties = Object::findByType(OWL_NS + "AnnotationProperty");
-    for ( auto const& owlAnnotationProperty : owlAnnotationProperties) {
+    for ( auto const& owlAnnotationProperty : index.subjectsOfType(OWL_NS + "AnnotationProperty") ) {
         if ( _verbose ) {
-            std::cout << "Found annotation property " << owlAnnotationProperty.iri() << std::endl;
+            std::cout << "Found annotation property " << SchemaIndex::iri(owlAnnotationProperty) << std::endl;
         }
         auto p = std::make_shared<AnnotationProperty>(this);
-        extractRDFS(owlAnnotationProperty, p.get());
-        extractProperty(owlAnnotationProperty, p.get());
+        extractRDFS(index, owlAnnotationProperty, p.get());
+        extractProperty(index, owlAnnotationProperty, p.get());
         addAnnotationProperty(p);
     }
 
     // Gather data Properties
-    const std::vector<Object>& owlDataProperties = Object::findByType(OWL_NS + "DatatypeProperty");
-    for ( auto const& owlDataProperty : owlDataProperties) {
+    for ( auto const& owlDataProperty : index.subjectsOfType(OWL_NS + "DatatypeProperty") ) {
         if ( _verbose ) {
-            std::cout << "Found data property " << owlDataProperty.iri() << std::endl;
+            std::cout << "Found data property " << SchemaIndex::iri(owlDataProperty) << std::endl;
         }
         auto p = std::make_shared<DataProperty>(this);
-        extractRDFS(owlDataProperty, p.get());
-        extractProperty(owlDataProperty, p.get());
+        extractRDFS(index, owlDataProperty, p.get());
+        extractProperty(index, owlDataProperty, p.get());
         addDataProperty(p);
     }
 
     // Gather object Properties
-    const std::vector<Object>& owlObjectProperties = Object::findByType(OWL_NS + "ObjectProperty");
-    for ( auto const& owlObjectProperty : owlObjectProperties) {
+    for ( auto const& owlObjectProperty : index.subjectsOfType(OWL_NS + "ObjectProperty") ) {
         if ( _verbose ) {
-            std::cout << "Found object property " << owlObjectProperty.iri() << std::endl;
+            std::cout << "Found object property " << SchemaIndex::iri(owlObjectProperty) << std::endl;
         }
         auto p = std::make_shared<ObjectProperty>(this);
-        extractRDFS(owlObjectProperty, p.get());
-        extractProperty(owlObjectProperty, p.get());
+        extractRDFS(index, owlObjectProperty, p.get());
+        extractProperty(index, owlObjectProperty, p.get());
         addObjectProperty(p);
     }
 
     // Gather classes
-    extractClasses(OWL_NS + "Class");
-    extractClasses(RDFS_NS + "Class");
+    extractClasses(index, OWL_NS + "Class");
+    extractClasses(index, RDFS_NS + "Class");
 
     // Remove reference to unexisting classes
     for ( auto const& klasses : _classUri2Ptr ) {
@@ -167,172 +177,159 @@ void Ontology::populateSchemaClasses(const Factory *f) {
     }
 }
 
-void Ontology::extractRDFS(const Object& o, RdfsEntity *rdfs) {
-    rdfs->_rdfname = o.iri();
-    rdfs->_comment = o.getPropertyValueList(RDFS_NS + "comment", false);
-    rdfs->_label = o.getPropertyValueList(RDFS_NS + "label", false);
-    rdfs->_seeAlso = o.getPropertyValueList(RDFS_NS + "seeAlso", false);
-    rdfs->_isDefinedBy = o.getPropertyValueList(RDFS_NS + "isDefinedBy", false);
+void Ontology::extractRDFS(const SchemaIndex& index, const Node& o, RdfsEntity *rdfs) {
+    rdfs->_rdfname = SchemaIndex::iri(o);
+    rdfs->_comment = index.propertyValues(o, RDFS_NS + "comment");
+    rdfs->_label = index.propertyValues(o, RDFS_NS + "label");
+    rdfs->_seeAlso = index.propertyValues(o, RDFS_NS + "seeAlso");
+    rdfs->_isDefinedBy = index.propertyValues(o, RDFS_NS + "isDefinedBy");
 }
 
-void Ontology::extractClassCardinality(const Object& o, Klass *kls, const char * card, const char * minCard, const char * maxCard) {
-    std::string propertyIRI = o.getPropertyValue(OWL_NS + "onProperty");
-    if ( o.getOptionalPropertyValue(OWL_NS + card) ) {
-        unsigned int cardinality = boost::lexical_cast<unsigned int>(o.getPropertyValue(OWL_NS + card));
+void Ontology::extractClassCardinality(const SchemaIndex& index, const Node& o, const std::string& propertyIRI, Klass *kls,
+                                       const char * card, const char * minCard, const char * maxCard) {
+    if ( const Node* value = index.value(o, OWL_NS + card) ) {
+        unsigned int cardinality = boost::lexical_cast<unsigned int>(SchemaIndex::propertyValue(*value));
         kls->_overridenMinCardinality[propertyIRI] = cardinality;
         kls->_overridenMaxCardinality[propertyIRI] = cardinality;
     }
-    if ( o.getOptionalPropertyValue(OWL_NS + minCard) ) {
-        kls->_overridenMinCardinality[propertyIRI] = boost::lexical_cast<unsigned int>(o.getPropertyValue(OWL_NS + minCard));
+    if ( const Node* value = index.value(o, OWL_NS + minCard) ) {
+        kls->_overridenMinCardinality[propertyIRI] = boost::lexical_cast<unsigned int>(SchemaIndex::propertyValue(*value));
     }
-    if ( o.getOptionalPropertyValue(OWL_NS + maxCard) ) {
-        kls->_overridenMaxCardinality[propertyIRI] = boost::lexical_cast<unsigned int>(o.getPropertyValue(OWL_NS + maxCard));
+    if ( const Node* value = index.value(o, OWL_NS + maxCard) ) {
+        kls->_overridenMaxCardinality[propertyIRI] = boost::lexical_cast<unsigned int>(SchemaIndex::propertyValue(*value));
     }
 }
 
-void Ontology::extractClass(const Object& o, Klass *kls) {
-    const std::vector<Object>& subClasses = o.getObjectList(RDFS_NS + "subClassOf", false);
-    for ( const Object& subclass : subClasses ) {
-        if ( !subclass.iri().empty() ) {
+void Ontology::extractClass(const SchemaIndex& index, const Node& o, Klass *kls) {
+    for ( const Node& subclass : index.values(o, RDFS_NS + "subClassOf") ) {
+        if ( !SchemaIndex::iri(subclass).empty() ) {
             // This is a named ancestor, that will be processes seperately, handle that through
             // standard C++ inheritance mechanism
-            kls->_directAncestors.insert(subclass.iri());
+            kls->_directAncestors.insert(SchemaIndex::iri(subclass));
         } else {
             // Anonymous ancestor, merge with current class
-            extractClass(subclass, kls);
+            extractClass(index, subclass, kls);
         }
     }
     kls->_directAncestors.insert(OWL_NS + "Thing");
 
     // If we are processing an anonymous ancestor
-    if ( o.isA(OWL_NS + "Restriction") ) {
+    if ( index.isA(o, OWL_NS + "Restriction") ) {
         // Add class to list of known classes
-        const Object& property = o.getObject(OWL_NS + "onProperty");
-        if (property.isA(OWL_NS + "ObjectProperty")) {
-            if (containsObjectProperty(property.iri())) {
-                kls->_objectProperties.insert(_objectPropertyUri2Ptr.at(property.iri()));
+        const Node& property = index.requiredValue(o, OWL_NS + "onProperty");
+        const std::string propertyIRI = SchemaIndex::iri(property);
+        if (index.isA(property, OWL_NS + "ObjectProperty")) {
+            if (containsObjectProperty(propertyIRI)) {
+                kls->_objectProperties.insert(_objectPropertyUri2Ptr.at(propertyIRI));
             } else {
-                std::cerr << "Property " << property.iri() << " is referenced by anonymous class restriction, but is not defined anywhere, zapping." << std::endl;
+                std::cerr << "Property " << propertyIRI << " is referenced by anonymous class restriction, but is not defined anywhere, zapping." << std::endl;
             }
         } else {
-            if (containsDataProperty(property.iri())) {
-                kls->_dataProperties.insert(_dataPropertyUri2Ptr.at(property.iri()));
+            if (containsDataProperty(propertyIRI)) {
+                kls->_dataProperties.insert(_dataPropertyUri2Ptr.at(propertyIRI));
             } else {
-                std::cerr << "Property " << property.iri() << " is referenced by anonymous class restriction, but is not defined anywhere, zapping." << std::endl;
+                std::cerr << "Property " << propertyIRI << " is referenced by anonymous class restriction, but is not defined anywhere, zapping." << std::endl;
             }
         }
         // FIXME: who has priority ?
-        extractClassCardinality(o, kls, "cardinality", "minCardinality", "maxCardinality");
-        extractClassCardinality(o, kls, "qualifiedCardinality", "minQualifiedCardinality", "maxQualifiedCardinality");
+        const std::string restrictedIRI = SchemaIndex::propertyValue(property);
+        extractClassCardinality(index, o, restrictedIRI, kls, "cardinality", "minCardinality", "maxCardinality");
+        extractClassCardinality(index, o, restrictedIRI, kls, "qualifiedCardinality", "minQualifiedCardinality", "maxQualifiedCardinality");
 
-        if (o.getOptionalPropertyValue(OWL_NS + "onDataRange")) {
-            kls->_overridenRange[property.iri()] = o.getPropertyValue(OWL_NS + "onDataRange");
+        if (const Node* dataRange = index.value(o, OWL_NS + "onDataRange")) {
+            kls->_overridenRange[propertyIRI] = SchemaIndex::propertyValue(*dataRange);
         }
-        if (o.getOptionalPropertyValue(OWL_NS + "onClass")) {
-            kls->_overridenRange[property.iri()] = o.getPropertyValue(OWL_NS + "onClass");
+        if (const Node* onClass = index.value(o, OWL_NS + "onClass")) {
+            kls->_overridenRange[propertyIRI] = SchemaIndex::propertyValue(*onClass);
         }
     }
 
     // Handle enum types
-    std::optional<Object> oneof = o.getOptionalObject(OWL_NS + "oneOf");
-    if ( oneof ) {
-        auto rest = oneof;
-        while ( rest && rest->iri() != RDF_NS + "nil" ) {
-            Object oneOfObject(rest->getPropertyValue(RDF_NS + "first"));
-            RdfsEntity oneOfVal(this);
-            extractRDFS(oneOfObject, &oneOfVal);
-            kls->_oneOfValues.insert(oneOfVal);
-            rest = rest->getOptionalObject(RDF_NS + "rest");
-        }
+    const Node* rest = index.value(o, OWL_NS + "oneOf");
+    while ( rest && SchemaIndex::iri(*rest) != RDF_NS + "nil" ) {
+        const Node oneOfObject = SchemaIndex::resource(SchemaIndex::propertyValue(index.requiredValue(*rest, RDF_NS + "first")));
+        RdfsEntity oneOfVal(this);
+        extractRDFS(index, oneOfObject, &oneOfVal);
+        kls->_oneOfValues.insert(oneOfVal);
+        rest = index.value(*rest, RDF_NS + "rest");
     }
 
     // Handle keys
-    std::vector<Object> keys = o.getObjectList(OWL_NS + "hasKey", false);
-    for ( const Object& key : keys ) {
-        auto rest = std::make_optional(Object(key));
-        while ( rest && rest->iri() != RDF_NS + "nil" ) {
-            kls->_keys.insert(rest->getPropertyValue(RDF_NS + "first"));
-            rest = rest->getOptionalObject(RDF_NS + "rest");
+    for ( const Node& key : index.values(o, OWL_NS + "hasKey") ) {
+        const Node* keyRest = &key;
+        while ( keyRest && SchemaIndex::iri(*keyRest) != RDF_NS + "nil" ) {
+            kls->_keys.insert(SchemaIndex::propertyValue(index.requiredValue(*keyRest, RDF_NS + "first")));
+            keyRest = index.value(*keyRest, RDF_NS + "rest");
         }
     }
 
     // FIXME can loop endlessly
-    const std::vector<Object>& equivalentClasses = o.getObjectList(OWL_NS + "equivalentClass", false);
-    for ( const Object& equivalentClass: equivalentClasses ) {
-        extractClass(equivalentClass, kls);
+    for ( const Node& equivalentClass: index.values(o, OWL_NS + "equivalentClass") ) {
+        extractClass(index, equivalentClass, kls);
     }
 }
 
-void Ontology::extractProperty(const Object& o, Property *prop) {
-    std::vector<Object> domainList = o.getObjectList(RDFS_NS + "domain", false);
+void Ontology::extractProperty(const SchemaIndex& index, const Node& o, Property *prop) {
+    const std::vector<Node>& domainList = index.values(o, RDFS_NS + "domain");
     if ( domainList.size() == 1 ) {
-        const Object& frontDomain = domainList.front();
+        const Node& frontDomain = domainList.front();
 
-        if ( frontDomain.iri().length() ) {
-            prop->_domains.push_back(frontDomain.iri());
+        if ( SchemaIndex::iri(frontDomain).length() ) {
+            prop->_domains.push_back(SchemaIndex::iri(frontDomain));
         } else {
             // Anonymous class, test for Union
-            std::optional<Object> rest = frontDomain.getOptionalObject(OWL_NS + "unionOf");
-            while ( rest && rest->iri() != RDF_NS + "nil" ) {
-                Object unionOfObject(rest->getPropertyValue(RDF_NS + "first"));
-                prop->_domains.push_back(unionOfObject.iri());
-                rest = rest->getOptionalObject(RDF_NS + "rest");
+            const Node* rest = index.value(frontDomain, OWL_NS + "unionOf");
+            while ( rest && SchemaIndex::iri(*rest) != RDF_NS + "nil" ) {
+                prop->_domains.push_back(SchemaIndex::propertyValue(index.requiredValue(*rest, RDF_NS + "first")));
+                rest = index.value(*rest, RDF_NS + "rest");
             }
         }
     } else if ( domainList.size() > 1 ) {
-        std::stringstream ss;
-        std::cerr << "rdfs#domain has more than one item for " << o.iri() << ", skipping!" << std::endl;
+        std::cerr << "rdfs#domain has more than one item for " << SchemaIndex::iri(o) << ", skipping!" << std::endl;
     }
 
-    std::vector<Object> rangeList = o.getObjectList(RDFS_NS + "range", false);
+    const std::vector<Node>& rangeList = index.values(o, RDFS_NS + "range");
     if ( rangeList.size() == 1 ) {
-        prop->_range = rangeList.front().iri();
+        prop->_range = SchemaIndex::iri(rangeList.front());
     } else if ( rangeList.size() > 1 ) {
         std::stringstream ss;
-        ss << "rdfs#range has more than one item for " << o.iri();
+        ss << "rdfs#range has more than one item for " << SchemaIndex::iri(o);
         throw std::runtime_error(ss.str());
     }
-    if ( o.isA(OWL_NS + "FunctionalProperty") ) {
+    if ( index.isA(o, OWL_NS + "FunctionalProperty") ) {
         prop->_minCardinality = 0;
         prop->_maxCardinality = 1;
     }
 
-    prop->_ordered = o.getOptionalPropertyValue(AUTORDF_NS + "ordered").has_value() ;
+    prop->_ordered = index.value(o, AUTORDF_NS + "ordered") != nullptr;
 }
 
-void Ontology::extractClass(const Object& rdfsClass) {
-    auto k = std::make_shared<Klass>(this);
-    extractRDFS(rdfsClass, k.get());
-    extractClass(rdfsClass, k.get());
-    addClass(k);
-}
-
-void Ontology::extractClasses(const std::string& classTypeIRI) {
-    const std::vector<Object>& classes = Object::findByType(classTypeIRI);
-    for ( auto const& rdfsclass : classes) {
-        if ( rdfsclass.iri().length() ) {
-            if ( !containsClass(rdfsclass.iri()) ) {
-                if ( !model()->iriPrefix(rdfsclass.iri()).empty() ) {
+void Ontology::extractClasses(const SchemaIndex& index, const std::string& classTypeIRI) {
+    for ( auto const& rdfsclass : index.subjectsOfType(classTypeIRI) ) {
+        const std::string classIRI = SchemaIndex::iri(rdfsclass);
+        if ( classIRI.length() ) {
+            if ( !containsClass(classIRI) ) {
+                if ( !model()->iriPrefix(classIRI).empty() ) {
                     if ( _verbose ) {
-                        std::cout << "Found class " << rdfsclass.iri() << std::endl;
+                        std::cout << "Found class " << classIRI << std::endl;
                     }
                     auto k = std::make_shared<Klass>(this);
-                    extractRDFS(rdfsclass, k.get());
-                    extractClass(rdfsclass, k.get());
+                    extractRDFS(index, rdfsclass, k.get());
+                    extractClass(index, rdfsclass, k.get());
                     addClass(k);
                 } else {
-                    std::cerr << "No prefix found for class " << rdfsclass.iri() << " namespace, ignoring" << std::endl;
+                    std::cerr << "No prefix found for class " << classIRI << " namespace, ignoring" << std::endl;
                 }
             }
         }
     }
 }
 
-void Ontology::addHardcodedAnnotationProperty(const std::string& iri, const std::string& label) {
-        const Object& object = Object(iri);
+void Ontology::addHardcodedAnnotationProperty(const SchemaIndex& index, const std::string& iri, const std::string& label) {
+        const Node object = SchemaIndex::resource(iri);
         auto p = std::make_shared<AnnotationProperty>(this);
-        extractRDFS(object, p.get());
-        extractProperty(object, p.get());
+        extractRDFS(index, object, p.get());
+        extractProperty(index, object, p.get());
         if (p->label().empty()) {
             p->_label = {label};
         }
@@ -342,6 +339,402 @@ void Ontology::addHardcodedAnnotationProperty(const std::string& iri, const std:
         addAnnotationProperty(p);
 }
 
+namespace {
+
+const char CACHE_MAGIC[] = "AUTORDF-ONTOLOGY";
+/** Bumped each time the layout written by Ontology::save() changes */
+const uint32_t CACHE_VERSION = 1;
+
+class CacheWriter {
+public:
+    explicit CacheWriter(std::ostream& os) : _os(os) {}
+
+    void write(uint32_t val) {
+        char bytes[4];
+        for ( int i = 0; i < 4; ++i ) {
+            bytes[i] = static_cast<char>((val >> (8 * i)) & 0xFF);
+        }
+        _os.write(bytes, sizeof(bytes));
+    }
+
+    void write(const std::string& str) {
+        write(static_cast<uint32_t>(str.size()));
+        _os.write(str.data(), str.size());
+    }
+
+    void write(const PropertyValue& val) {
+        write(static_cast<const std::string&>(val));
+        write(val.lang());
+        write(val.dataTypeIri());
+    }
+
+    template<typename CONTAINER> void writeAll(const CONTAINER& container) {
+        write(static_cast<uint32_t>(container.size()));
+        for ( const auto& item : container ) {
+            write(item);
+        }
+    }
+
+    template<typename VALUE> void writeMap(const std::map<std::string, VALUE>& map) {
+        write(static_cast<uint32_t>(map.size()));
+        for ( const auto& item : map ) {
+            write(item.first);
+            write(item.second);
+        }
+    }
+
+    template<typename SET> void writeRdfNames(const SET& entities) {
+        write(static_cast<uint32_t>(entities.size()));
+        for ( const auto& entity : entities ) {
+            write(entity->rdfname());
+        }
+    }
+
+private:
+    std::ostream& _os;
+};
+
+class CacheReader {
+public:
+    explicit CacheReader(std::istream& is) : _is(is), _remaining(remainingBytes(is)) {}
+
+    uint32_t readUInt() {
+        unsigned char bytes[4];
+        read(reinterpret_cast<char *>(bytes), sizeof(bytes));
+        uint32_t val = 0;
+        for ( int i = 0; i < 4; ++i ) {
+            val |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+        }
+        return val;
+    }
+
+    std::string readString() {
+        const uint32_t size = readUInt();
+        checkRemaining(size);
+        // Stream size may be unknown: string grows as bytes are actually read, so that a corrupted length
+        // is not allocated in full before reaching the end of stream
+        std::string str;
+        while ( str.size() < size ) {
+            const size_t offset = str.size();
+            str.resize(offset + std::min<size_t>(size - offset, CHUNK_SIZE));
+            read(&str[offset], str.size() - offset);
+        }
+        return str;
+    }
+
+    PropertyValue readPropertyValue() {
+        std::string rawValue = readString();
+        std::string lang = readString();
+        return PropertyValue(rawValue, lang, readString());
+    }
+
+    std::vector<PropertyValue> readPropertyValues() {
+        // Each value is at least its 3 string lengths
+        std::vector<PropertyValue> values(readCount(3 * sizeof(uint32_t)));
+        for ( PropertyValue& value : values ) {
+            value = readPropertyValue();
+        }
+        return values;
+    }
+
+    std::vector<std::string> readStrings() {
+        std::vector<std::string> strings(readCount(sizeof(uint32_t)));
+        for ( std::string& str : strings ) {
+            str = readString();
+        }
+        return strings;
+    }
+
+    std::map<std::string, std::string> readStringMap() {
+        std::map<std::string, std::string> map;
+        for ( uint32_t count = readUInt(); count; --count ) {
+            std::string key = readString();
+            map[key] = readString();
+        }
+        return map;
+    }
+
+    std::map<std::string, unsigned int> readUIntMap() {
+        std::map<std::string, unsigned int> map;
+        for ( uint32_t count = readUInt(); count; --count ) {
+            std::string key = readString();
+            map[key] = readUInt();
+        }
+        return map;
+    }
+
+    template<typename SET, typename MAP> void readRdfNames(const MAP& uri2Ptr, SET *entities) {
+        for ( const std::string& iri : readStrings() ) {
+            auto it = uri2Ptr.find(iri);
+            if ( it == uri2Ptr.end() ) {
+                throw InvalidOntologyCache("Class refers to unknown property " + iri);
+            }
+            entities->insert(it->second);
+        }
+    }
+
+private:
+    static const size_t CHUNK_SIZE = 64 * 1024;
+    static const uint64_t UNKNOWN = std::numeric_limits<uint64_t>::max();
+
+    std::istream& _is;
+    // Bytes left in stream, UNKNOWN if stream can not seek
+    uint64_t _remaining;
+
+    static uint64_t remainingBytes(std::istream& is) {
+        const std::istream::pos_type current = is.tellg();
+        if ( current == std::istream::pos_type(-1) || !is.seekg(0, std::ios_base::end) ) {
+            is.clear();
+            return UNKNOWN;
+        }
+        const std::istream::pos_type end = is.tellg();
+        is.seekg(current);
+        return end > current ? static_cast<uint64_t>(end - current) : 0;
+    }
+
+    /**
+     * Reads a count of elements, each stored using at least minElementSize bytes
+     */
+    uint32_t readCount(size_t minElementSize) {
+        const uint32_t count = readUInt();
+        checkRemaining(static_cast<uint64_t>(count) * minElementSize);
+        return count;
+    }
+
+    /**
+     * A length larger than what is left in stream means the cache is truncated or corrupted
+     */
+    void checkRemaining(uint64_t size) const {
+        if ( _remaining != UNKNOWN && size > _remaining ) {
+            throw InvalidOntologyCache("Length " + std::to_string(size) + " is beyond end of stream");
+        }
+    }
+
+    void read(char *buffer, size_t size) {
+        if ( size && !_is.read(buffer, size) ) {
+            throw InvalidOntologyCache("Unexpected end of stream");
+        }
+        if ( _remaining != UNKNOWN ) {
+            _remaining -= std::min<uint64_t>(size, _remaining);
+        }
+    }
+};
+
+}
+
+Ontology::Ontology(const Factory* f, std::istream& cache, const std::string& key, bool verbose) : _verbose(verbose), _f(f) {
+    autordf::Object::setFactory(const_cast<Factory*>(f)) ;
+    restore(cache, key);
+    computeClassHierarchy();
+    buildValidationPlans();
+}
+
+void Ontology::save(std::ostream& cache, const std::string& key) const {
+    CacheWriter writer(cache);
+    cache.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    writer.write(CACHE_VERSION);
+    writer.write(key);
+
+    auto writeEntity = [&writer](const RdfsEntity& entity) {
+        writer.write(entity._rdfname);
+        writer.writeAll(entity._comment);
+        writer.writeAll(entity._label);
+        writer.writeAll(entity._seeAlso);
+        writer.writeAll(entity._isDefinedBy);
+    };
+    auto writeProperties = [&](const auto& uri2Ptr) {
+        writer.write(static_cast<uint32_t>(uri2Ptr.size()));
+        for ( auto const& propertyMapItem : uri2Ptr ) {
+            const Property& property = *propertyMapItem.second;
+            writeEntity(property);
+            writer.writeAll(property._domains);
+            writer.write(property._range);
+            writer.write(property._minCardinality);
+            writer.write(property._maxCardinality);
+            writer.write(property._ordered);
+        }
+    };
+    writeProperties(_annotationPropertyUri2Ptr);
+    writeProperties(_dataPropertyUri2Ptr);
+    writeProperties(_objectPropertyUri2Ptr);
+
+    writer.write(static_cast<uint32_t>(_classUri2Ptr.size()));
+    for ( auto const& klassMapItem : _classUri2Ptr ) {
+        const Klass& kls = *klassMapItem.second;
+        writeEntity(kls);
+        writer.writeAll(kls._directAncestors);
+        writer.writeRdfNames(kls._annotationProperties);
+        writer.writeRdfNames(kls._dataProperties);
+        writer.writeRdfNames(kls._objectProperties);
+        writer.writeRdfNames(kls._annotationKeys);
+        writer.writeRdfNames(kls._dataKeys);
+        writer.writeRdfNames(kls._objectKeys);
+        writer.writeMap(kls._overridenRange);
+        writer.writeMap(kls._overridenMinCardinality);
+        writer.writeMap(kls._overridenMaxCardinality);
+        writer.write(static_cast<uint32_t>(kls._oneOfValues.size()));
+        for ( const RdfsEntity& oneOfValue : kls._oneOfValues ) {
+            writeEntity(oneOfValue);
+        }
+        writer.writeAll(kls._keys);
+    }
+
+    if ( !cache ) {
+        throw FileIOError("Unable to write ontology cache");
+    }
+}
+
+void Ontology::restore(std::istream& cache, const std::string& key) {
+    char magic[sizeof(CACHE_MAGIC)];
+    if ( !cache.read(magic, sizeof(magic)) || std::string(magic, sizeof(magic)) != std::string(CACHE_MAGIC, sizeof(CACHE_MAGIC)) ) {
+        throw InvalidOntologyCache("Stream is not an ontology cache");
+    }
+    CacheReader reader(cache);
+    if ( reader.readUInt() != CACHE_VERSION ) {
+        throw InvalidOntologyCache("Ontology cache was written by another version");
+    }
+    if ( reader.readString() != key && !key.empty() ) {
+        throw InvalidOntologyCache("Ontology cache was written for other sources");
+    }
+
+    auto readEntity = [&reader](RdfsEntity *entity) {
+        entity->_rdfname = reader.readString();
+        entity->_comment = reader.readPropertyValues();
+        entity->_label = reader.readPropertyValues();
+        entity->_seeAlso = reader.readPropertyValues();
+        entity->_isDefinedBy = reader.readPropertyValues();
+    };
+    auto readProperties = [&]<typename PropertyType>(std::map<std::string, std::shared_ptr<PropertyType> > *uri2Ptr) {
+        for ( uint32_t count = reader.readUInt(); count; --count ) {
+            auto p = std::make_shared<PropertyType>(this);
+            readEntity(p.get());
+            for ( const std::string& domain : reader.readStrings() ) {
+                p->_domains.push_back(domain);
+            }
+            p->_range = reader.readString();
+            p->_minCardinality = reader.readUInt();
+            p->_maxCardinality = reader.readUInt();
+            p->_ordered = reader.readUInt();
+            (*uri2Ptr)[p->rdfname()] = p;
+        }
+    };
+    readProperties(&_annotationPropertyUri2Ptr);
+    readProperties(&_dataPropertyUri2Ptr);
+    readProperties(&_objectPropertyUri2Ptr);
+
+    for ( uint32_t count = reader.readUInt(); count; --count ) {
+        auto kls = std::make_shared<Klass>(this);
+        readEntity(kls.get());
+        for ( const std::string& ancestor : reader.readStrings() ) {
+            kls->_directAncestors.insert(ancestor);
+        }
+        reader.readRdfNames(_annotationPropertyUri2Ptr, &kls->_annotationProperties);
+        reader.readRdfNames(_dataPropertyUri2Ptr, &kls->_dataProperties);
+        reader.readRdfNames(_objectPropertyUri2Ptr, &kls->_objectProperties);
+        reader.readRdfNames(_annotationPropertyUri2Ptr, &kls->_annotationKeys);
+        reader.readRdfNames(_dataPropertyUri2Ptr, &kls->_dataKeys);
+        reader.readRdfNames(_objectPropertyUri2Ptr, &kls->_objectKeys);
+        kls->_overridenRange = reader.readStringMap();
+        kls->_overridenMinCardinality = reader.readUIntMap();
+        kls->_overridenMaxCardinality = reader.readUIntMap();
+        for ( uint32_t oneOfCount = reader.readUInt(); oneOfCount; --oneOfCount ) {
+            RdfsEntity oneOfValue(this);
+            readEntity(&oneOfValue);
+            kls->_oneOfValues.insert(oneOfValue);
+        }
+        for ( const std::string& key : reader.readStrings() ) {
+            kls->_keys.insert(key);
+        }
+        addClass(kls);
+    }
+}
+
+void Ontology::computeClassHierarchy() {
+    _classes.clear();
+    for ( auto const& klassMapItem : _classUri2Ptr ) {
+        klassMapItem.second->_index = _classes.size();
+        _classes.push_back(klassMapItem.second);
+    }
+    const size_t count = _classes.size();
+
+    std::vector<std::vector<size_t> > directAncestors(count);
+    for ( const std::shared_ptr<Klass>& kls : _classes ) {
+        kls->_directPredecessors.resize(count);
+        kls->_allAncestors.resize(count);
+        kls->_allPredecessors.resize(count);
+    }
+    for ( const std::shared_ptr<Klass>& kls : _classes ) {
+        for ( const std::string& ancestorIri : kls->_directAncestors ) {
+            auto ancestorIt = _classUri2Ptr.find(ancestorIri);
+            if ( ancestorIt != _classUri2Ptr.end() ) {
+                directAncestors[kls->_index].push_back(ancestorIt->second->_index);
+                ancestorIt->second->_directPredecessors.set(kls->_index);
+            }
+        }
+    }
+
+    // Classes of a subClassOf cycle are ancestors of each other, and share the same ancestors closure.
+    // Strongly connected components of the ancestors graph are found using Tarjan algorithm, which
+    // emits a component only once all the components it leads to are emitted: the closure of a component
+    // is then the union of its members direct ancestors, and of these ancestors closures
+    const size_t UNVISITED = std::numeric_limits<size_t>::max();
+    std::vector<size_t> order(count, UNVISITED);
+    std::vector<size_t> lowLink(count);
+    std::vector<bool> onStack(count, false);
+    std::vector<size_t> stack;
+    size_t nextOrder = 0;
+    std::function<void (size_t)> closeAncestors = [&](size_t index) {
+        order[index] = lowLink[index] = nextOrder++;
+        stack.push_back(index);
+        onStack[index] = true;
+        for ( size_t ancestor : directAncestors[index] ) {
+            if ( order[ancestor] == UNVISITED ) {
+                closeAncestors(ancestor);
+                lowLink[index] = std::min(lowLink[index], lowLink[ancestor]);
+            } else if ( onStack[ancestor] ) {
+                lowLink[index] = std::min(lowLink[index], order[ancestor]);
+            }
+        }
+        if ( lowLink[index] != order[index] ) {
+            return;
+        }
+        auto componentBegin = std::find(stack.begin(), stack.end(), index);
+        boost::dynamic_bitset<> all(count);
+        for ( auto member = componentBegin; member != stack.end(); ++member ) {
+            for ( size_t ancestor : directAncestors[*member] ) {
+                all.set(ancestor);
+                all |= _classes[ancestor]->_allAncestors;
+            }
+        }
+        for ( auto member = componentBegin; member != stack.end(); ++member ) {
+            onStack[*member] = false;
+            _classes[*member]->_allAncestors = all;
+            // A class is not its own ancestor, even when on a cycle
+            _classes[*member]->_allAncestors.reset(*member);
+        }
+        stack.erase(componentBegin, stack.end());
+    };
+    for ( size_t index = 0; index < count; ++index ) {
+        if ( order[index] == UNVISITED ) {
+            closeAncestors(index);
+        }
+    }
+
+    // Predecessors closure is the transposed ancestors closure
+    for ( const std::shared_ptr<Klass>& kls : _classes ) {
+        for ( size_t ancestor = kls->_allAncestors.find_first(); ancestor != boost::dynamic_bitset<>::npos;
+              ancestor = kls->_allAncestors.find_next(ancestor) ) {
+            _classes[ancestor]->_allPredecessors.set(kls->_index);
+        }
+    }
+}
+
+void Ontology::buildValidationPlans() {
+    for ( auto const& klassMapItem : _classUri2Ptr ) {
+        _validationPlans[klassMapItem.first] = std::make_shared<const ValidationPlan>(*klassMapItem.second);
+    }
+}
+
 void Ontology::addAnnotationProperty(const std::shared_ptr<AnnotationProperty>& obj) {
     if (_annotationPropertyUri2Ptr.find(obj->rdfname()) == _annotationPropertyUri2Ptr.end()) {
         _annotationPropertyUri2Ptr[obj->rdfname()] = obj;
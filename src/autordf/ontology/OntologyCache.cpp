@@ -0,0 +1,107 @@
+#include "autordf/ontology/OntologyCache.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "autordf/Exception.h"
+
+namespace autordf {
+namespace ontology {
+
+namespace {
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+void fnv1a(uint64_t *hash, const char *data, size_t size) {
+    for ( size_t i = 0; i < size; ++i ) {
+        *hash ^= static_cast<unsigned char>(data[i]);
+        *hash *= FNV_PRIME;
+    }
+}
+
+// Length comes first, so that "ab" + "c" and "a" + "bc" give different hashes
+void fnv1aString(uint64_t *hash, const std::string& s) {
+    const uint64_t size = s.size();
+    fnv1a(hash, reinterpret_cast<const char *>(&size), sizeof(size));
+    fnv1a(hash, s.data(), s.size());
+}
+}
+
+OntologyCache::OntologyCache(const std::string& cacheFile, const std::vector<std::string>& inputFiles,
+                             const std::map<std::string, std::string>& namespacesPrefixes, const std::string& baseIRI)
+    : _cacheFile(cacheFile), _key(fingerprint(inputFiles, namespacesPrefixes, baseIRI)) {
+}
+
+std::unique_ptr<Ontology> OntologyCache::load(const Factory *f, bool verbose) const {
+    std::ifstream ifs(_cacheFile, std::ios::binary);
+    if ( ifs ) {
+        try {
+            std::unique_ptr<Ontology> ontology(new Ontology(f, ifs, _key, verbose));
+            if ( verbose ) {
+                std::cout << "Ontology read from cache " << _cacheFile << std::endl;
+            }
+            return ontology;
+        } catch ( const InvalidOntologyCache& e ) {
+            if ( verbose ) {
+                std::cout << "Discarding cache " << _cacheFile << ": " << e.what() << std::endl;
+            }
+        }
+    }
+
+    std::unique_ptr<Ontology> ontology(new Ontology(f, verbose));
+
+    // Write to a temporary file first, so that a concurrent reader never sees a partial cache
+    const std::string tmpFile = _cacheFile + ".tmp";
+    {
+        std::ofstream ofs(tmpFile, std::ios::binary | std::ios::trunc);
+        try {
+            ontology->save(ofs, _key);
+        } catch ( const FileIOError& e ) {
+            std::cerr << "Unable to write ontology cache " << _cacheFile << ": " << e.what() << std::endl;
+            std::remove(tmpFile.c_str());
+            return ontology;
+        }
+    }
+    if ( std::rename(tmpFile.c_str(), _cacheFile.c_str()) != 0 ) {
+        std::cerr << "Unable to write ontology cache " << _cacheFile << std::endl;
+        std::remove(tmpFile.c_str());
+    } else if ( verbose ) {
+        std::cout << "Ontology written to cache " << _cacheFile << std::endl;
+    }
+    return ontology;
+}
+
+std::string OntologyCache::fingerprint(const std::vector<std::string>& inputFiles,
+                                       const std::map<std::string, std::string>& namespacesPrefixes, const std::string& baseIRI) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    char buffer[64 * 1024];
+    for ( const std::string& inputFile : inputFiles ) {
+        std::ifstream ifs(inputFile, std::ios::binary);
+        if ( !ifs ) {
+            throw FileIOError("Unable to read " + inputFile);
+        }
+        uint64_t size = 0;
+        while ( ifs.read(buffer, sizeof(buffer)) || ifs.gcount() ) {
+            fnv1a(&hash, buffer, ifs.gcount());
+            size += ifs.gcount();
+        }
+        // Files boundaries are part of the key: concatenating sources differently gives another key
+        fnv1a(&hash, reinterpret_cast<const char *>(&size), sizeof(size));
+    }
+    // Classes without a namespace prefix are left out of the ontology, and relative IRIs resolve against the base IRI
+    for ( const auto& prefixNamespace : namespacesPrefixes ) {
+        fnv1aString(&hash, prefixNamespace.first);
+        fnv1aString(&hash, prefixNamespace.second);
+    }
+    fnv1aString(&hash, baseIRI);
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return ss.str();
+}
+
+}
+}
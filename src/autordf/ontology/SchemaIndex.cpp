@@ -0,0 +1,131 @@
+#include "SchemaIndex.h"
+
+#include <sstream>
+
+#include "autordf/Exception.h"
+#include "autordf/Model.h"
+#include "autordf/Statement.h"
+#include "autordf/StatementList.h"
+#include "autordf/ontology/Ontology.h"
+
+namespace autordf {
+namespace ontology {
+
+SchemaIndex::SchemaIndex(const Model& model) {
+    const std::string& RDF = Ontology::RDF_NS;
+    const std::string& RDFS = Ontology::RDFS_NS;
+    const std::string& OWL = Ontology::OWL_NS;
+    const std::string& AUTORDF = Ontology::AUTORDF_NS;
+    const std::vector<std::string> predicates = {
+        RDFS + "comment", RDFS + "label", RDFS + "seeAlso", RDFS + "isDefinedBy",
+        RDFS + "subClassOf", RDFS + "domain", RDFS + "range",
+        OWL + "onProperty", OWL + "onClass", OWL + "onDataRange",
+        OWL + "cardinality", OWL + "minCardinality", OWL + "maxCardinality",
+        OWL + "qualifiedCardinality", OWL + "minQualifiedCardinality", OWL + "maxQualifiedCardinality",
+        OWL + "oneOf", OWL + "unionOf", OWL + "hasKey", OWL + "equivalentClass",
+        RDF + "first", RDF + "rest",
+        AUTORDF + "ordered"
+    };
+
+    Statement request;
+    request.predicate = resource(RDF + "type");
+    for ( const Statement& stmt : model.find(request) ) {
+        if ( stmt.object.type() == NodeType::RESOURCE ) {
+            const std::string typeIri = stmt.object.iri();
+            if ( _subjects[key(stmt.subject)].types.insert(typeIri).second ) {
+                _subjectsByType[typeIri].push_back(stmt.subject);
+            }
+        }
+    }
+
+    for ( const std::string& predicate : predicates ) {
+        request.predicate = resource(predicate);
+        for ( const Statement& stmt : model.find(request) ) {
+            _subjects[key(stmt.subject)].values[predicate].push_back(stmt.object);
+        }
+    }
+}
+
+const std::vector<Node>& SchemaIndex::subjectsOfType(const std::string& typeIri) const {
+    static const std::vector<Node> NONE;
+    auto it = _subjectsByType.find(typeIri);
+    return it != _subjectsByType.end() ? it->second : NONE;
+}
+
+bool SchemaIndex::isA(const Node& subject, const std::string& typeIri) const {
+    const Subject* s = find(subject);
+    return s && s->types.count(typeIri);
+}
+
+const std::vector<Node>& SchemaIndex::values(const Node& subject, const std::string& predicateIri) const {
+    static const std::vector<Node> NONE;
+    const Subject* s = find(subject);
+    if ( s ) {
+        auto it = s->values.find(predicateIri);
+        if ( it != s->values.end() ) {
+            return it->second;
+        }
+    }
+    return NONE;
+}
+
+const Node* SchemaIndex::value(const Node& subject, const std::string& predicateIri) const {
+    const std::vector<Node>& nodes = values(subject, predicateIri);
+    return nodes.empty() ? nullptr : &nodes.front();
+}
+
+const Node& SchemaIndex::requiredValue(const Node& subject, const std::string& predicateIri) const {
+    const Node* node = value(subject, predicateIri);
+    if ( !node ) {
+        std::stringstream ss;
+        ss << "Property " << predicateIri << " not found in " << propertyValue(subject) << " resource." << std::endl;
+        throw PropertyNotFound(ss.str());
+    }
+    return *node;
+}
+
+std::vector<PropertyValue> SchemaIndex::propertyValues(const Node& subject, const std::string& predicateIri) const {
+    std::vector<PropertyValue> result;
+    for ( const Node& node : values(subject, predicateIri) ) {
+        result.push_back(propertyValue(node));
+    }
+    return result;
+}
+
+PropertyValue SchemaIndex::propertyValue(const Node& node) {
+    switch ( node.type() ) {
+        case NodeType::LITERAL:
+            return PropertyValue(node.literal(), node.lang(), node.dataType());
+        case NodeType::RESOURCE:
+            return PropertyValue(node.iri());
+        case NodeType::BLANK:
+            return PropertyValue(node.bNodeId());
+        default:
+            return PropertyValue();
+    }
+}
+
+std::string SchemaIndex::iri(const Node& node) {
+    return node.type() == NodeType::RESOURCE ? node.iri() : "";
+}
+
+Node SchemaIndex::resource(const std::string& iri) {
+    Node node;
+    node.setIri(iri);
+    return node;
+}
+
+std::string SchemaIndex::key(const Node& node) {
+    if ( node.type() == NodeType::BLANK ) {
+        return std::string("_:") + node.bNodeId();
+    }
+    return node.iri();
+}
+
+const SchemaIndex::Subject* SchemaIndex::find(const Node& subject) const {
+    auto it = _subjects.find(key(subject));
+    return it != _subjects.end() ? &it->second : nullptr;
+}
+
+}
+}
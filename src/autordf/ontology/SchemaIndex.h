@@ -0,0 +1,96 @@
+#ifndef AUTORDF_ONTOLOGY_SCHEMAINDEX_H
+#define AUTORDF_ONTOLOGY_SCHEMAINDEX_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <autordf/Node.h>
+#include <autordf/PropertyValue.h>
+
+namespace autordf {
+
+class Model;
+
+namespace ontology {
+
+/**
+ * In memory view of the schema triples of a model, used to load an ontology.
+ *
+ * The model is read once, using one scan per schema predicate (rdf:type, rdfs:subClassOf, rdfs:domain,
+ * rdfs:range, owl restrictions, rdf lists...). Triples are then grouped by subject, so that extracting a class or
+ * a property is a matter of hash lookups instead of model queries.
+ * Reified statements are not taken into account: schema triples are never reified.
+ */
+class SchemaIndex {
+public:
+    /**
+     * Scans the schema triples of the model
+     */
+    explicit SchemaIndex(const Model& model);
+
+    /**
+     * Subjects having the given rdf:type, in model order
+     */
+    const std::vector<Node>& subjectsOfType(const std::string& typeIri) const;
+
+    /**
+     * Returns true if subject has the given rdf:type
+     */
+    bool isA(const Node& subject, const std::string& typeIri) const;
+
+    /**
+     * Values of predicate for subject, empty if none
+     */
+    const std::vector<Node>& values(const Node& subject, const std::string& predicateIri) const;
+
+    /**
+     * First value of predicate for subject, nullptr if none
+     */
+    const Node* value(const Node& subject, const std::string& predicateIri) const;
+
+    /**
+     * First value of predicate for subject
+     * @throw PropertyNotFound if none
+     */
+    const Node& requiredValue(const Node& subject, const std::string& predicateIri) const;
+
+    /**
+     * Values of predicate for subject, the way Object::getPropertyValueList() returns them
+     */
+    std::vector<PropertyValue> propertyValues(const Node& subject, const std::string& predicateIri) const;
+
+    /**
+     * Returns the node as a PropertyValue, the way Object::getPropertyValue() returns it
+     */
+    static PropertyValue propertyValue(const Node& node);
+
+    /**
+     * IRI of node, the way Object::iri() returns it: empty if node is not a resource
+     */
+    static std::string iri(const Node& node);
+
+    /**
+     * Builds a resource node
+     */
+    static Node resource(const std::string& iri);
+
+private:
+    struct Subject {
+        std::unordered_set<std::string> types;
+        std::unordered_map<std::string, std::vector<Node>> values;
+    };
+
+    std::unordered_map<std::string, Subject> _subjects;
+    std::unordered_map<std::string, std::vector<Node>> _subjectsByType;
+
+    static std::string key(const Node& node);
+
+    const Subject* find(const Node& subject) const;
+};
+
+}
+}
+
+#endif //AUTORDF_ONTOLOGY_SCHEMAINDEX_H
@@ -0,0 +1,83 @@
+#include "autordf/ontology/ValidationPlan.h"
+
+#include <algorithm>
+
+#include "autordf/ontology/Ontology.h"
+#include "autordf/ontology/Klass.h"
+
+namespace autordf {
+namespace ontology {
+
+bool ValidationPlan::Rule::acceptsTypes(const std::vector<Uri>& types, const Ontology& ontology) const {
+    for (const Uri& type: types) {
+        if (type == range) {
+            return true;
+        }
+        auto kls = ontology.classUri2Ptr().find(type);
+        if (kls != ontology.classUri2Ptr().end() && kls->second->index() < acceptedTypes.size() &&
+            acceptedTypes.test(kls->second->index())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ValidationPlan::ValidationPlan(const Klass& kls) : _klass(&kls), _ownSegment(0) {
+    std::vector<const Klass*> hierarchy = {&kls};
+    const boost::dynamic_bitset<>& ancestors = kls.allAncestorsMask();
+    for (size_t index = ancestors.find_first(); index != boost::dynamic_bitset<>::npos; index = ancestors.find_next(index)) {
+        hierarchy.push_back(kls.ontology()->classAt(index).get());
+    }
+    // Rules are run in class IRI order, whatever the class the object is an instance of
+    std::sort(hierarchy.begin(), hierarchy.end(), [](const Klass* k1, const Klass* k2) {
+        return k1->rdfname() < k2->rdfname();
+    });
+
+    for (const Klass* current: hierarchy) {
+        if (current == &kls) {
+            _ownSegment = _segments.size();
+        }
+        size_t begin = _rules.size();
+        addRules(*current);
+        _segments.push_back({current, begin, _rules.size()});
+    }
+}
+
+void ValidationPlan::addRules(const Klass& kls) {
+    auto addRule = [this, &kls](Rule::Kind kind, const Property& property) {
+        Rule rule;
+        rule.kind = kind;
+        rule.predicate = property.rdfname();
+        rule.minCardinality = property.minCardinality(kls);
+        rule.maxCardinality = property.maxCardinality(kls);
+        rule.range = property.range(&kls);
+        const std::list<std::string>& domains = property.domains();
+        rule.inDomain = std::find(domains.begin(), domains.end(), kls.rdfname()) != domains.end();
+        if (kind == Rule::DATA) {
+            auto rdfType = cvt::rdfMapType.find(rule.range);
+            if (rdfType != cvt::rdfMapType.end()) {
+                rule.dataType = rdfType->second;
+            }
+        } else {
+            auto rangeClass = kls.ontology()->classUri2Ptr().find(rule.range);
+            if (rangeClass != kls.ontology()->classUri2Ptr().end()) {
+                rule.acceptedTypes = rangeClass->second->allPredecessorsMask();
+                rule.acceptedTypes.set(rangeClass->second->index());
+            }
+        }
+        _rules.push_back(std::move(rule));
+    };
+
+    for (auto const& annotationProperty: kls.annotationProperties()) {
+        addRule(Rule::DATA, *annotationProperty);
+    }
+    for (auto const& dataProperty: kls.dataProperties()) {
+        addRule(Rule::DATA, *dataProperty);
+    }
+    for (auto const& objectProperty: kls.objectProperties()) {
+        addRule(Rule::OBJECT, *objectProperty);
+    }
+}
+
+}
+}
@@ -1,5 +1,7 @@
 #include <boost/date_time.hpp>
+#include <algorithm>
 #include <functional>
+#include <unordered_map>
 
 #include "autordf/ontology/Validator.h"
 
@@ -142,62 +144,59 @@ bool isDataTypeValid(const autordf::PropertyValue& property, const autordf::cvt:
 }
 
 /**
- * @brief validatePropertyValue
- * @param object autordf::Object to validate
- * @param currentCLass Rdf Class to get all data property from
- * @param property
+ * @brief nodeValue
+ * @param node value read back from the model
+ * return the node as a PropertyValue, the way Object::getPropertyValueList() would return it
+ */
+PropertyValue nodeValue(const Node& node) {
+    switch (node.type()) {
+        case NodeType::LITERAL:
+            return PropertyValue(node.literal(), node.lang(), node.dataType());
+        case NodeType::RESOURCE:
+            return PropertyValue(node.iri());
+        case NodeType::BLANK:
+            return PropertyValue(node.bNodeId());
+        default:
+            return PropertyValue();
+    }
+}
+
+/**
+ * @brief validateCardinality
+ * @param error error prefilled with object, property and count
+ * @param rule rule giving allowed cardinalities
  * @param errorList list of errors
- * Fill the given error list with OWL errors found on the object Dataproperty or Annotationproperty
+ * Fill the given error list with cardinality errors
  */
-void validatePropertyValue(const Object& object, const Klass& currentCLass,
-                           const Property& property, std::vector<validation::Error> *errorList) {
-    unsigned int maxCardinality = property.maxCardinality(currentCLass);
-    unsigned int minCardinality = property.minCardinality(currentCLass);
-    Uri range = property.range(&currentCLass);
-    std::vector<PropertyValue> propList = object.getPropertyValueList(property.rdfname(), false);
-    validation::Error error(object, property.rdfname());
-    error.count = propList.size();
-    if (propList.size() > maxCardinality) {
+void validateCardinality(validation::Error& error, const ValidationPlan::Rule& rule,
+                         std::vector<validation::Error> *errorList) {
+    if (error.count > rule.maxCardinality) {
         error.type = error.TOOMANYVALUES;
         error.message = "\'@subject\' property \'@property\' has @count distinct values. Maximum allowed is @val";
-        error.val = maxCardinality;
+        error.val = (int) rule.maxCardinality;
         errorList->push_back(error);
     }
-    if (propList.size() < minCardinality) {
+    if (error.count < rule.minCardinality) {
         error.type = error.NOTENOUHVALUES;
         error.message = "\'@subject\' property \'@property\' has @count distinct values. Minimum allowed is @val";
-        error.val = minCardinality;
+        error.val = (int) rule.minCardinality;
         errorList->push_back(error);
     }
-
-    auto rdfType = cvt::rdfMapType.find(range);
-    if (rdfType != autordf::cvt::rdfMapType.end()) {
-        autordf::cvt::RdfTypeEnum rdfTypeEnum = rdfType->second;
-        for (auto const& prop: propList) {
-            if (!isDataTypeValid(prop, rdfTypeEnum)) {
-                error.type = error.INVALIDDATATYPE;
-                error.message =
-                        "\'@subject\' property \'@property\' value \'" + prop + "\' is not convertible as @range";
-                error.range = cvt::rdfTypeEnumXMLString(rdfTypeEnum);
-                errorList->push_back(error);
-            }
-        }
-    }
 }
 
 /**
- * @brief validateDomainProperties
+ * @brief validateDomain
  * @param object autordf::Object to validate
- * @param currentCLass Rdf Class to get all data property from
+ * @param currentClass Rdf Class the rule comes from
+ * @param rule rule to check
  * @param errorList list of errors
  * Fill the given error list with OWL errors found on a domain of a property
  */
-void validateDomainProperties(const Object& object, const Klass& currentClass,
-                              const Property& property, std::vector<validation::Error> *errorList) {
-    validation::Error error(object, property.rdfname());
+void validateDomain(const Object& object, const Klass& currentClass,
+                    const ValidationPlan::Rule& rule, std::vector<validation::Error> *errorList) {
     // Verify that the class is in the property domain list
-    auto domains = property.domains();
-    if (std::find(domains.begin(), domains.end(), currentClass.rdfname()) == domains.end()) {
+    if (!rule.inDomain) {
+        validation::Error error(object, rule.predicate);
         error.type = Error::INVALIDDOMAIN;
         error.message = currentClass.rdfname().prettyName()
                         + " class should be in the \'@property\' domain";
@@ -205,188 +204,259 @@ void validateDomainProperties(const Object& object, const Klass& currentClass,
     }
 }
 
-void
-validateAnnotationProperties(const Object& object, const Klass& currentCLass, const validation::ValidationOption& option,
-                             std::vector<validation::Error> *errorList) {
+/**
+ * @brief validateDataRule
+ * @param object autordf::Object to validate
+ * @param currentClass Rdf Class the rule comes from
+ * @param rule rule for a data or annotation property
+ * @param values values of the property for this object
+ * @param errorList list of errors
+ * Fill the given error list with OWL errors found on the object Dataproperty or Annotationproperty
+ */
+void validateDataRule(const Object& object, const Klass& currentClass, const ValidationPlan::Rule& rule,
+                      const std::vector<Node>& values, const validation::ValidationOption& option,
+                      std::vector<validation::Error> *errorList) {
+    validation::Error error(object, rule.predicate);
+    error.count = values.size();
+    validateCardinality(error, rule, errorList);
 
-    for (auto const& annotationProperty: currentCLass.annotationProperties()) {
-        validatePropertyValue(object, currentCLass, *annotationProperty, errorList);
-        if (option.enforceExplicitDomains) {
-            validateDomainProperties(object, currentCLass, *annotationProperty, errorList);
+    if (rule.dataType) {
+        for (const Node& value: values) {
+            PropertyValue prop = nodeValue(value);
+            if (!isDataTypeValid(prop, *rule.dataType)) {
+                error.type = error.INVALIDDATATYPE;
+                error.message =
+                        "\'@subject\' property \'@property\' value \'" + prop + "\' is not convertible as @range";
+                error.range = cvt::rdfTypeEnumXMLString(*rule.dataType);
+                errorList->push_back(error);
+            }
         }
     }
+
+    if (option.enforceExplicitDomains) {
+        validateDomain(object, currentClass, rule, errorList);
+    }
 }
 
 /**
- * @brief validateDataProperties
+ * @brief validateObjectRule
  * @param object autordf::Object to validate
- * @param currentCLass Rdf Class to get all data property from
+ * @param currentClass Rdf Class the rule comes from
+ * @param rule rule for an object property
+ * @param values values of the property for this object
  * @param errorList list of errors
- * Fill the given error list with OWL errors found on the object Dataproperty
+ * Fill the given error list with OWL errors found on the object's objectProperties
  */
-void validateDataProperties(const Object& object, const Klass& currentCLass, const validation::ValidationOption& option,
-                            std::vector<validation::Error> *errorList) {
-    for (auto const& dataProperty: currentCLass.dataProperties()) {
-        validatePropertyValue(object, currentCLass, *dataProperty, errorList);
-        if (option.enforceExplicitDomains) {
-            validateDomainProperties(object, currentCLass, *dataProperty, errorList);
+void validateObjectRule(const Object& object, const Klass& currentClass, const ValidationPlan::Rule& rule,
+                        const std::vector<Node>& values, const validation::ValidationOption& option,
+                        std::vector<validation::Error> *errorList) {
+    if (option.enforceExplicitDomains) {
+        validateDomain(object, currentClass, rule, errorList);
+    }
+
+    validation::Error error(object, rule.predicate);
+    error.count = values.size();
+    validateCardinality(error, rule, errorList);
+
+    for (const Node& value: values) {
+        Object subObj = Object::createFromNode(value);
+        std::vector<Uri> types = subObj.getTypes();
+        if (!rule.acceptsTypes(types, *currentClass.ontology())) {
+            error.subject = subObj.iri().empty() ? object : subObj;
+            std::stringstream ss;
+            if (!types.empty()) {
+                ss << "\'@subject\' property \'@property\' is of incompatible object type.";
+                ss << " RDF expected type is @range while provided type is {";
+                for (auto it = types.begin(); it != types.end(); ++it) {
+                    ss << *it;
+                    if (it != types.end()) {
+                        ss << ", ";
+                    } else {
+                        ss << "}";
+                    }
+                }
+            } else {
+                ss << "\'@subject\' property \'@property\' has no type, while RDF expected type is @range";
+            }
+            error.message = ss.str();
+            error.range = rule.range;
+            error.type = error.INVALIDTYPE;
+            errorList->push_back(error);
         }
     }
 }
 
+/**
+ * Key errors already computed for each class during a validation run
+ */
+typedef std::map<std::string, Error::Vec> KeyErrorCache;
+
+/**
+ * @brief keyValueHash
+ * @param value key value
+ * return a string identifying the value, with the same equality as PropertyValue::operator==
+ */
+std::string keyValueHash(const PropertyValue& value) {
+    std::string hash(value);
+    hash += '\0';
+    if (!value.dataTypeIri().empty()) {
+        hash += value.dataTypeIri();
+    } else {
+        // No data type stands for xsd:string, or rdf:langString for tagged literals
+        hash += cvt::rdfTypeIri(value.lang().empty() ? cvt::RdfTypeEnum::xsd_string : cvt::RdfTypeEnum::rdf_langString);
+    }
+    hash += '\0';
+    hash += value.lang();
+    return hash;
+}
+
 /**
  * @brief validateDataKeys
- * @param object autordf::Object to validate
- * @param currentCLass Rdf Class to get all data property from
+ * @param currentClass Rdf Class to check keys of
  * @param errorList list of errors
  * Fill the given error list with OWL errors found on the object KeyData
+ * All instances of the class are read in a single pass, and their key values indexed in a hash table
  */
 void validateDataKeys(const Klass& currentClass,
                       std::vector<validation::Error> *errorList) {
-    auto dataKeys = currentClass.dataKeys();
+    auto const& dataKeys = currentClass.dataKeys();
     if (dataKeys.empty()) {
         return;
     }
     std::vector<Object> objList = Object::findByType(currentClass.rdfname());
-    std::map<Uri, std::list<PropertyValue>> propListAll;
 
-    for (auto const& obj: objList) {
-        for (auto const& dataKey: dataKeys) {
-            std::vector<PropertyValue> propListCurrent = obj.getPropertyValueList(dataKey->rdfname(), false);
-            auto& propList = propListAll[dataKey->rdfname()];
-            propList.insert(propList.end(), propListCurrent.begin(), propListCurrent.end());
+    for (auto const& dataKey: dataKeys) {
+        // Objects sharing each value, values being kept in the order they were first met
+        std::unordered_map<std::string, size_t> valueIndex;
+        std::vector<std::pair<PropertyValue, std::vector<Object>>> valueObjects;
 
+        for (auto const& obj: objList) {
+            for (const PropertyValue& value: obj.getPropertyValueList(dataKey->rdfname(), false)) {
+                auto inserted = valueIndex.emplace(keyValueHash(value), valueObjects.size());
+                if (inserted.second) {
+                    valueObjects.emplace_back(value, std::vector<Object>());
+                }
+                valueObjects[inserted.first->second].second.push_back(obj);
+            }
         }
-    }
 
-    for (auto& prop: propListAll) {
-        prop.second.sort();
-        auto duplicated = std::adjacent_find(prop.second.begin(), prop.second.end());
-        if (duplicated != prop.second.end()) {
-            validation::Error error(currentClass.rdfname(), prop.first);
-            error.type = validation::Error::DUPLICATEDVALUESKEY;
-            error.message = "\'@subject\' class key \'@property\' has the duplicated value \'" + *duplicated + '\'';
-            errorList->push_back(error);
+        for (auto const& valueObject: valueObjects) {
+            if (valueObject.second.size() > 1) {
+                validation::Error error(currentClass.rdfname(), dataKey->rdfname());
+                error.type = validation::Error::DUPLICATEDVALUESKEY;
+                error.message = "\'@subject\' class key \'@property\' has the duplicated value \'" + valueObject.first + '\'';
+                error.count = valueObject.second.size();
+                error.duplicates = valueObject.second;
+                errorList->push_back(error);
+            }
         }
     }
 }
 
 /**
- * @brief isObjectTypeValid
- * @param object the object to check type
- * @param type expected type of the object
- * return true if the given object is of the given type or type's subclass, false otherwise
+ * @brief validateDataKeys
+ * @param currentClass Rdf Class to check keys of
+ * @param cache if not null, key errors computed by previous calls in the same validation run
+ * @param errorList list of errors
+ * Same as above, each class being checked only once per validation run
  */
-bool isObjectTypeValid(const Ontology& ontology,
-                       const autordf::Object& object, const autordf::Uri& type) {
-    if (object.isA(type)) {
-        return true;
-    } else {
-        std::shared_ptr<const autordf::ontology::Klass> klass = ontology.findClass(type);
-        if (klass) {
-            for (const auto& predecessor: klass->getAllPredecessors()) {
-                if (object.isA(predecessor->rdfname())) {
-                    return true;
-                }
-            }
-        }
+void validateDataKeys(const Klass& currentClass, KeyErrorCache *cache,
+                      std::vector<validation::Error> *errorList) {
+    if (!cache) {
+        validateDataKeys(currentClass, errorList);
+        return;
     }
-    return false;
+    auto cached = cache->find(currentClass.rdfname());
+    if (cached == cache->end()) {
+        Error::Vec keyErrors;
+        validateDataKeys(currentClass, &keyErrors);
+        cached = cache->emplace(currentClass.rdfname(), std::move(keyErrors)).first;
+    }
+    errorList->insert(errorList->end(), cached->second.begin(), cached->second.end());
 }
 
 /**
- * @brief validateObjectProperty
- * @param object autordf::Object to validate
- * @param currentCLass Rdf Class to get all data property from
- * @param errorList list of errors
- * Fill the given error list with OWL errors found on the object's objectProperties
+ * @brief validateObjectImpl
+ * Implementation of validateObject(), sharing key errors with other objects through cache if not null
  */
-void validateObjectProperties(const Ontology& ontology, const Object& object, const Klass& currentClass,
-                              const validation::ValidationOption& option, std::vector<validation::Error> *errorList) {
+std::vector<validation::Error> validateObjectImpl(const Ontology& ontology,
+                                                  const Object& object,
+                                                  const validation::ValidationOption& option,
+                                                  KeyErrorCache *cache) {
+    static const std::vector<Node> NOVALUES;
+    typedef std::pair<const ValidationPlan*, const ValidationPlan::Segment*> PlanSegment;
 
-    for (auto const& objectProperty: currentClass.objectProperties()) {
-        if (option.enforceExplicitDomains) {
-            validateDomainProperties(object, currentClass, *objectProperty, errorList);
-        }
-        unsigned int maxCardinality = objectProperty->maxCardinality(currentClass);
-        unsigned int minCardinality = objectProperty->minCardinality(currentClass);
-        autordf::Uri range = objectProperty->range(&currentClass);
-        std::vector<Object> objList = object.getObjectList(objectProperty->rdfname(), false);
-        validation::Error error(object, objectProperty->rdfname());
-        error.count = (int) objList.size();
-        if (objList.size() > maxCardinality) {
-            error.type = error.TOOMANYVALUES;
-            error.message = "\'@subject\' property \'@property\' has @count distinct values. Maximum allowed is @val";
-            error.val = (int) maxCardinality;
-            errorList->push_back(error);
-        }
-        if (objList.size() < minCardinality) {
-            error.type = error.NOTENOUHVALUES;
-            error.message = "\'@subject\' property \'@property\' has @count distinct values. Minimum allowed is @val";
-            error.val = (int) minCardinality;
-            errorList->push_back(error);
-        }
-        for (auto const& subObj: objList) {
-            if (!isObjectTypeValid(ontology, subObj, range)) {
-                error.subject = subObj.iri().empty() ? object : subObj;
-                std::stringstream ss;
-                std::vector<PropertyValue> types = subObj.getPropertyValueList(Object::RDF_TYPE, false);
-                if (!types.empty()) {
-                    ss << "\'@subject\' property \'@property\' is of incompatible object type.";
-                    ss << " RDF expected type is @range while provided type is {";
-                    for (auto it = types.begin(); it != types.end(); ++it) {
-                        ss << *it;
-                        if (it != types.end()) {
-                            ss << ", ";
-                        } else {
-                            ss << "}";
-                        }
-                    }
-                } else {
-                    ss << "\'@subject\' property \'@property\' has no type, while RDF expected type is @range";
+    Error::Vec errorList;
+    const std::map<Uri, std::vector<Node>> values = object.getAllPropertyNodes();
+
+    // Gather rules from the plans of all object types, each class being checked only once
+    std::vector<PlanSegment> segments;
+    unsigned int planCount = 0;
+    auto types = values.find(Object::RDF_TYPE);
+    if (types != values.end()) {
+        const std::string& namespaceFilter = ontology.model()->baseUri();
+        for (const Node& typeNode: types->second) {
+            if (typeNode.type() != NodeType::RESOURCE) {
+                continue;
+            }
+            std::string type = typeNode.iri();
+            if ((namespaceFilter.empty() || type.find(namespaceFilter) == 0) && ontology.containsClass(type)) {
+                const ValidationPlan& plan = ontology.validationPlan(type);
+                for (const ValidationPlan::Segment& segment: plan.segments()) {
+                    segments.emplace_back(&plan, &segment);
                 }
-                error.message = ss.str();
-                error.range = range;
-                error.type = error.INVALIDTYPE;
-                errorList->push_back(error);
+                ++planCount;
             }
         }
     }
-}
+    if (planCount > 1) {
+        std::sort(segments.begin(), segments.end(), [](const PlanSegment& s1, const PlanSegment& s2) {
+            return s1.second->klass->rdfname() < s2.second->klass->rdfname();
+        });
+        segments.erase(std::unique(segments.begin(), segments.end(), [](const PlanSegment& s1, const PlanSegment& s2) {
+            return s1.second->klass == s2.second->klass;
+        }), segments.end());
+    }
 
-std::vector<validation::Error> validateObject(const Ontology& ontology,
-                                              const Object& object,
-                                              const validation::ValidationOption& option) {
-    Error::Vec errorList;
-    std::vector<Uri> types = object.getTypes(ontology.model()->baseUri());
-    std::set<Klass> allKlass;
-    for (const Uri& type: types) {
-        if (ontology.containsClass(type)) {
-            std::shared_ptr<const Klass> uriKlass = ontology.findClass(type);
-            allKlass.insert(*uriKlass);
-            for (auto const& ancestor: uriKlass->getAllAncestors()) {
-                allKlass.insert(*ancestor);
+    for (const PlanSegment& planSegment: segments) {
+        const Klass& kl = *planSegment.second->klass;
+        for (size_t i = planSegment.second->begin; i < planSegment.second->end; ++i) {
+            const ValidationPlan::Rule& rule = planSegment.first->rules()[i];
+            auto ruleValues = values.find(rule.predicate);
+            const std::vector<Node>& nodes = ruleValues != values.end() ? ruleValues->second : NOVALUES;
+            if (rule.kind == ValidationPlan::Rule::DATA) {
+                validateDataRule(object, kl, rule, nodes, option, &errorList);
+            } else {
+                validateObjectRule(object, kl, rule, nodes, option, &errorList);
             }
         }
-    }
-    for (const Klass& kl: allKlass) {
-        validateAnnotationProperties(object, kl, option, &errorList);
-        validateDataProperties(object, kl, option, &errorList);
-        validateObjectProperties(ontology, object, kl, option, &errorList);
         if (option.enforceObjectKeyUniqueness) {
-            validateDataKeys(kl, &errorList);
+            validateDataKeys(kl, cache, &errorList);
         }
     }
     return errorList;
 }
 
+std::vector<validation::Error> validateObject(const Ontology& ontology,
+                                              const Object& object,
+                                              const validation::ValidationOption& option) {
+    return validateObjectImpl(ontology, object, option, nullptr);
+}
+
+std::vector<validation::Error> validateKeys(const Ontology& ontology, const Klass& klass) {
+    Error::Vec errorList;
+    validateDataKeys(klass, &errorList);
+    return errorList;
+}
+
 std::vector<validation::Error> validateModel(const Ontology& ontology,
                                              const validation::ValidationOption& option) {
     Error::Vec errorList;
+    KeyErrorCache keyErrors;
     for (const auto& uriKlass: ontology.classUri2Ptr()) {
         std::vector<Object> objects = Object::findByType(uriKlass.first);
         for (auto const& object: objects) {
-            Error::Vec objErrors = validateObject(ontology, object, option);
+            Error::Vec objErrors = validateObjectImpl(ontology, object, option, &keyErrors);
             errorList.insert(errorList.end(), objErrors.begin(), objErrors.end());
         }
     }
@@ -6,12 +6,17 @@
 
 
 
+#include <algorithm>
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
 
 #include "autordf/Factory.h"
 #include "autordf/ontology/Ontology.h"
+#include "autordf/ontology/OntologyCache.h"
 #include "autordf/ontology/Validator.h"
+#include "autordf/ontology/IncrementalValidator.h"
 
 using namespace autordf;
 using namespace ontology;
@@ -171,6 +176,10 @@ TEST_F(ValidatorTest, UniqueKeyValidatorFail) {
     ASSERT_EQ(1, errors.size());
     EXPECT_EQ(validation::Error::DUPLICATEDVALUESKEY, errors.at(0).type);
     EXPECT_EQ("\'Schema\' class key \'schemaUniqueName\' has the duplicated value \'sharedSchemaKey\'", errors.at(0).fullMessage());
+    EXPECT_EQ(2, errors.at(0).count);
+    const std::set<Object> duplicates(errors.at(0).duplicates.begin(), errors.at(0).duplicates.end());
+    EXPECT_EQ(std::set<Object>({Object("http://example.org/geometry#schema1"), Object("http://example.org/geometry#schema2repeated")}),
+              duplicates);
 
     // The error is indeed catched at runtime
     EXPECT_THROW(
@@ -212,3 +221,184 @@ TEST_F(ValidatorTest, ModelValidator) {
 }
 
 
+
+TEST_F(ValidatorTest, IncrementalValidator) {
+    auto validator = std::make_shared<validation::IncrementalValidator>(*ontology);
+    factory.setNotifier(validator);
+    const size_t initialErrors = validator->validateAll().size();
+    EXPECT_FALSE(validator->isDirty());
+
+    Object point("http://example.org/geometry#pointWithoutY");
+    const PropertyValue y = PropertyValue().set<cvt::RdfTypeEnum::xsd_double>(-2.0);
+    point.setPropertyValue("http://example.org/geometry#y", y);
+    EXPECT_TRUE(validator->isDirty());
+    EXPECT_EQ(initialErrors - 1, validator->revalidate().size());
+    EXPECT_FALSE(validator->isDirty());
+
+    point.removePropertyValue("http://example.org/geometry#y", y);
+    const auto errors = validator->revalidate();
+    EXPECT_EQ(initialErrors, errors.size());
+    EXPECT_EQ(errors.size(), validation::IncrementalValidator(*ontology).validateAll().size());
+}
+
+TEST_F(ValidatorTest, IncrementalValidatorEmptyModel) {
+    Factory empty;
+    Object::setFactory(&empty);
+    auto validator = std::make_shared<validation::IncrementalValidator>(*ontology);
+    empty.setNotifier(validator);
+    EXPECT_FALSE(validator->isDirty());
+    EXPECT_TRUE(validator->revalidate().empty());
+    EXPECT_TRUE(validator->validateAll().empty());
+    EXPECT_FALSE(validator->isDirty());
+    EXPECT_TRUE(validator->revalidate().empty());
+    EXPECT_TRUE(validator->errors().empty());
+    Object::setFactory(&factory);
+}
+
+TEST_F(ValidatorTest, IncrementalValidatorErrors) {
+    const std::string geo = "http://example.org/geometry#";
+    auto validator = std::make_shared<validation::IncrementalValidator>(*ontology);
+    factory.setNotifier(validator);
+    validator->validateAll();
+    auto count = [&validator](const Object& subject, validation::Error::Type type) {
+        return std::count_if(validator->errors().begin(), validator->errors().end(), [&](const validation::Error& error) {
+            return error.subject == subject && error.type == type;
+        });
+    };
+
+    // Error in a modified subject
+    Object point("http://example.org/geometry#pointWithoutY");
+    point.setPropertyValue(geo + "x", PropertyValue("toto"));
+    validator->revalidate();
+    EXPECT_EQ(1, count(point, validation::Error::INVALIDDATATYPE));
+
+    // Error in a subject pointing to a retyped one
+    Object shape("http://example.org/geometry#myShape");
+    Object text = shape.getObject(geo + "text");
+    const auto invalidTypes = count(shape, validation::Error::INVALIDTYPE);
+    text.removeObject(Object::RDF_TYPE, Object(geo + "Text"));
+    validator->revalidate();
+    EXPECT_EQ(invalidTypes + 1, count(shape, validation::Error::INVALIDTYPE));
+
+    // Fixing errors removes them
+    point.setPropertyValue(geo + "x", PropertyValue().set<cvt::RdfTypeEnum::xsd_double>(42.0));
+    text.addObject(Object::RDF_TYPE, Object(geo + "Text"), false);
+    validator->revalidate();
+    EXPECT_FALSE(validator->isDirty());
+    EXPECT_EQ(0, count(point, validation::Error::INVALIDDATATYPE));
+    EXPECT_EQ(invalidTypes, count(shape, validation::Error::INVALIDTYPE));
+    EXPECT_EQ(validator->errors().size(), validation::IncrementalValidator(*ontology).validateAll().size());
+}
+
+TEST_F(ValidatorTest, ClassHierarchy) {
+    const std::string geo = "http://example.org/geometry#";
+    EXPECT_TRUE(ontology->isSubClassOf(geo + "Circle", geo + "Shape"));
+    EXPECT_TRUE(ontology->isSubClassOf(geo + "Circle", geo + "Circle"));
+    EXPECT_FALSE(ontology->isSubClassOf(geo + "Shape", geo + "Circle"));
+    EXPECT_FALSE(ontology->isSubClassOf(geo + "Circle", geo + "Polygon"));
+
+    std::set<std::string> predecessors;
+    for (auto const& predecessor: ontology->findClass(geo + "Shape")->getAllPredecessors()) {
+        predecessors.insert(predecessor->rdfname());
+        EXPECT_EQ(predecessor, ontology->classAt(predecessor->index()));
+    }
+    EXPECT_EQ(std::set<std::string>({geo + "Circle", geo + "Polygon", geo + "Rectangle"}), predecessors);
+}
+
+TEST_F(ValidatorTest, RuleAcceptsTypes) {
+    const std::string geo = "http://example.org/geometry#";
+    const ValidationPlan& plan = ontology->validationPlan(geo + "Schema");
+    auto rule = std::find_if(plan.rules().begin(), plan.rules().end(), [&](const ValidationPlan::Rule& rule) {
+        return rule.predicate == geo + "hasShape";
+    });
+    ASSERT_NE(plan.rules().end(), rule);
+    EXPECT_TRUE(rule->acceptsTypes({Uri(geo + "Shape")}, *ontology));
+    EXPECT_TRUE(rule->acceptsTypes({Uri(geo + "Rectangle")}, *ontology));
+    EXPECT_TRUE(rule->acceptsTypes({Uri("http://example.org/unknown#Type"), Uri(geo + "Circle")}, *ontology));
+    EXPECT_FALSE(rule->acceptsTypes({Uri(geo + "Point")}, *ontology));
+    EXPECT_FALSE(rule->acceptsTypes({Uri("http://example.org/unknown#Type")}, *ontology));
+    EXPECT_FALSE(rule->acceptsTypes({}, *ontology));
+}
+
+TEST_F(ValidatorTest, CyclicClassHierarchy) {
+    // A -> B -> C -> A cycle, reached from D, and leading to E
+    const char *turtle =
+        "@prefix owl: <http://www.w3.org/2002/07/owl#> .\n"
+        "@prefix rdfs: <http://www.w3.org/2000/01/rdf-schema#> .\n"
+        "@prefix : <http://example.org/cycle#> .\n"
+        ":A a owl:Class ; rdfs:subClassOf :B .\n"
+        ":B a owl:Class ; rdfs:subClassOf :C .\n"
+        ":C a owl:Class ; rdfs:subClassOf :A, :E .\n"
+        ":D a owl:Class ; rdfs:subClassOf :B .\n"
+        ":E a owl:Class .\n";
+    factory.loadFromMemory(turtle, "turtle");
+    const Ontology cyclic(&factory);
+
+    const std::string cycle = "http://example.org/cycle#";
+    auto names = [](const std::set<std::shared_ptr<const Klass> >& classes) {
+        std::set<std::string> rdfnames;
+        for (auto const& kls: classes) {
+            rdfnames.insert(kls->rdfname());
+        }
+        return rdfnames;
+    };
+    for (const std::string member: {"A", "B", "C"}) {
+        std::set<std::string> others = {cycle + "A", cycle + "B", cycle + "C"};
+        others.erase(cycle + member);
+        std::set<std::string> ancestors = others;
+        ancestors.insert(cycle + "E");
+        EXPECT_EQ(ancestors, names(cyclic.findClass(cycle + member)->getAllAncestors())) << member;
+        std::set<std::string> predecessors = others;
+        predecessors.insert(cycle + "D");
+        EXPECT_EQ(predecessors, names(cyclic.findClass(cycle + member)->getAllPredecessors())) << member;
+        EXPECT_TRUE(cyclic.isSubClassOf(cycle + "D", cycle + member));
+        EXPECT_FALSE(cyclic.isSubClassOf(cycle + member, cycle + "D"));
+    }
+    EXPECT_EQ(std::set<std::string>({cycle + "A", cycle + "B", cycle + "C", cycle + "E"}),
+              names(cyclic.findClass(cycle + "D")->getAllAncestors()));
+    EXPECT_EQ(std::set<std::string>({cycle + "A", cycle + "B", cycle + "C", cycle + "D"}),
+              names(cyclic.findClass(cycle + "E")->getAllPredecessors()));
+    EXPECT_EQ(4, cyclic.validationPlan(cycle + "D").segments().size());
+}
+
+TEST_F(ValidatorTest, OntologyCache) {
+    std::stringstream cache;
+    ontology->save(cache, "key");
+
+    std::stringstream otherKey(cache.str());
+    EXPECT_THROW(Ontology(&factory, otherKey, "otherKey"), InvalidOntologyCache);
+    std::stringstream truncated(cache.str().substr(0, cache.str().size() / 2));
+    EXPECT_THROW(Ontology(&factory, truncated, "key"), InvalidOntologyCache);
+    // Key length claims more bytes than the stream holds
+    std::string corrupted = cache.str();
+    const size_t keyLength = corrupted.find(std::string("\x03\0\0\0key", 7));
+    ASSERT_NE(std::string::npos, keyLength);
+    corrupted.replace(keyLength, 4, "\xf0\xff\xff\xff");
+    std::stringstream corruptedStream(corrupted);
+    EXPECT_THROW(Ontology(&factory, corruptedStream, "key"), InvalidOntologyCache);
+
+    const Ontology restored(&factory, cache, "key");
+    ASSERT_EQ(ontology->classUri2Ptr().size(), restored.classUri2Ptr().size());
+    EXPECT_EQ(ontology->dataPropertyUri2Ptr().size(), restored.dataPropertyUri2Ptr().size());
+    EXPECT_EQ(ontology->objectPropertyUri2Ptr().size(), restored.objectPropertyUri2Ptr().size());
+
+    const std::string geo = "http://example.org/geometry#";
+    EXPECT_TRUE(restored.isSubClassOf(geo + "Circle", geo + "Shape"));
+    std::shared_ptr<const Klass> point = restored.findClass(geo + "Point");
+    EXPECT_EQ(ontology->findClass(geo + "Point")->dataProperties().size(), point->dataProperties().size());
+    EXPECT_EQ(ontology->findClass(geo + "Point")->label(), point->label());
+
+    const Object obj("http://example.org/geometry#pointWithoutY");
+    EXPECT_EQ(validation::validateObject(*ontology, obj).size(), validation::validateObject(restored, obj).size());
+}
+
+TEST_F(ValidatorTest, OntologyCacheKey) {
+    const std::vector<std::string> files = {boost::filesystem::path(__FILE__).parent_path().string() + "/geometry-ontology.ttl"};
+    const std::string key = OntologyCache::fingerprint(files);
+    EXPECT_EQ(key, OntologyCache::fingerprint(files));
+    EXPECT_NE(key, OntologyCache::fingerprint(files, {{"geo", "http://example.org/geometry#"}}));
+    EXPECT_NE(OntologyCache::fingerprint(files, {{"geo", "http://example.org/geometry#"}}),
+              OntologyCache::fingerprint(files, {{"ge", "ohttp://example.org/geometry#"}}));
+    EXPECT_NE(key, OntologyCache::fingerprint(files, {}, "http://example.org/"));
+    EXPECT_EQ(key, OntologyCache(".", files).key());
+}
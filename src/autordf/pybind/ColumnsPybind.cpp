@@ -0,0 +1,271 @@
+//
+// Columnar export of literal values, for analytics libraries
+//
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "autordf/Factory.h"
+#include "autordf/Object.h"
+#include "autordf/StatementList.h"
+#include "autordf/cvt/RdfTypeEnum.h"
+#include "ModelLock.h"
+
+namespace py = pybind11;
+
+namespace {
+/**
+ * Contiguous values, exposed to Python through the buffer protocol: numpy.asarray(buffer) does not copy them
+ */
+struct Buffer {
+    std::shared_ptr<void> storage;
+    void *data = nullptr;
+    py::ssize_t size = 0;
+    py::ssize_t itemSize = 0;
+    std::string format;
+
+    template<typename T> static std::shared_ptr<Buffer> from(std::vector<T>&& values) {
+        auto stored = std::make_shared<std::vector<T>>(std::move(values));
+        auto buffer = std::make_shared<Buffer>();
+        buffer->data = stored->data();
+        buffer->size = stored->size();
+        buffer->itemSize = sizeof(T);
+        buffer->format = py::format_descriptor<T>::format();
+        buffer->storage = std::move(stored);
+        return buffer;
+    }
+};
+
+/**
+ * One value per row. Strings are stored Arrow-like: row i is data[offsets[i]:offsets[i + 1]]
+ */
+struct Column {
+    // One of int64, float64, bool, string
+    std::string kind;
+    // Row values, or utf-8 bytes of all rows for strings
+    std::shared_ptr<Buffer> values;
+    // For strings only, row count + 1 offsets into values
+    std::shared_ptr<Buffer> offsets;
+    // 1 if row has a value, 0 if it has none or a malformed one
+    std::shared_ptr<Buffer> valid;
+};
+
+enum class ValueKind { INTEGER, FLOAT, BOOLEAN, STRING };
+
+ValueKind valueKind(const autordf::Node& node) {
+    if (node.type() != autordf::NodeType::LITERAL || !node.dataType()) {
+        return ValueKind::STRING;
+    }
+    auto it = autordf::cvt::rdfMapType.find(node.dataType());
+    if (it == autordf::cvt::rdfMapType.end()) {
+        return ValueKind::STRING;
+    }
+    switch (it->second) {
+        case autordf::cvt::RdfTypeEnum::xsd_boolean:
+            return ValueKind::BOOLEAN;
+        case autordf::cvt::RdfTypeEnum::xsd_decimal:
+        case autordf::cvt::RdfTypeEnum::xsd_float:
+        case autordf::cvt::RdfTypeEnum::xsd_double:
+            return ValueKind::FLOAT;
+        case autordf::cvt::RdfTypeEnum::xsd_integer:
+        case autordf::cvt::RdfTypeEnum::xsd_nonNegativeInteger:
+        case autordf::cvt::RdfTypeEnum::xsd_positiveInteger:
+        case autordf::cvt::RdfTypeEnum::xsd_nonPositiveInteger:
+        case autordf::cvt::RdfTypeEnum::xsd_negativeInteger:
+        case autordf::cvt::RdfTypeEnum::xsd_long:
+        case autordf::cvt::RdfTypeEnum::xsd_unsignedLong:
+        case autordf::cvt::RdfTypeEnum::xsd_int:
+        case autordf::cvt::RdfTypeEnum::xsd_unsignedInt:
+        case autordf::cvt::RdfTypeEnum::xsd_short:
+        case autordf::cvt::RdfTypeEnum::xsd_unsignedShort:
+        case autordf::cvt::RdfTypeEnum::xsd_byte:
+        case autordf::cvt::RdfTypeEnum::xsd_unsignedByte:
+            return ValueKind::INTEGER;
+        default:
+            return ValueKind::STRING;
+    }
+}
+
+/**
+ * Text of a node: IRI, "_:" prefixed blank node id, or literal lexical form
+ */
+std::string nodeText(const autordf::Node& node) {
+    switch (node.type()) {
+        case autordf::NodeType::RESOURCE:
+            return node.iri();
+        case autordf::NodeType::BLANK:
+            return std::string("_:") + node.bNodeId();
+        default:
+            return node.literal();
+    }
+}
+
+template<typename T> std::from_chars_result parseNumber(const std::string& text, T *value) {
+    // from_chars is locale independent, but rejects the leading '+' XML Schema allows
+    const char *begin = text.data() + (!text.empty() && text[0] == '+' ? 1 : 0);
+    const char *end = text.data() + text.size();
+    auto result = std::from_chars(begin, end, *value);
+    if (result.ec == std::errc() && result.ptr != end) {
+        result.ec = std::errc::invalid_argument;
+    }
+    return result;
+}
+
+/**
+ * Tells if an integer literal fits in an int64 column
+ */
+bool fitsInt64(const std::string& text) {
+    int64_t value;
+    return parseNumber(text, &value).ec != std::errc::result_out_of_range;
+}
+
+Column stringColumn(const std::vector<const std::string*>& texts) {
+    std::vector<int64_t> offsets(1, 0);
+    std::vector<uint8_t> valid;
+    std::vector<uint8_t> data;
+    offsets.reserve(texts.size() + 1);
+    valid.reserve(texts.size());
+    for (const std::string* text : texts) {
+        if (text) {
+            data.insert(data.end(), text->begin(), text->end());
+        }
+        offsets.push_back(data.size());
+        valid.push_back(text != nullptr);
+    }
+    return {"string", Buffer::from(std::move(data)), Buffer::from(std::move(offsets)), Buffer::from(std::move(valid))};
+}
+
+/**
+ * Malformed literals make invalid rows, so that one bad value does not abort the whole export
+ */
+template<typename T> Column numberColumn(const char *kind, const std::vector<const std::string*>& texts) {
+    std::vector<T> values;
+    std::vector<uint8_t> valid;
+    values.reserve(texts.size());
+    valid.reserve(texts.size());
+    for (const std::string* text : texts) {
+        T value{};
+        bool parsed = text && parseNumber(*text, &value).ec == std::errc();
+        values.push_back(parsed ? value : T());
+        valid.push_back(parsed);
+    }
+    return {kind, Buffer::from(std::move(values)), nullptr, Buffer::from(std::move(valid))};
+}
+
+Column booleanColumn(const std::vector<const std::string*>& texts) {
+    std::vector<uint8_t> values;
+    std::vector<uint8_t> valid;
+    values.reserve(texts.size());
+    valid.reserve(texts.size());
+    for (const std::string* text : texts) {
+        values.push_back(text && (*text == "true" || *text == "1"));
+        valid.push_back(text && (*text == "true" || *text == "1" || *text == "false" || *text == "0"));
+    }
+    std::shared_ptr<Buffer> buffer = Buffer::from(std::move(values));
+    buffer->format = py::format_descriptor<bool>::format();
+    return {"bool", buffer, nullptr, Buffer::from(std::move(valid))};
+}
+
+/**
+ * Reads the first value of each property for each instance of typeIRI.
+ * Each property is one model query, bound on the predicate. Does not need the GIL
+ */
+std::vector<Column> scanColumns(const autordf::Factory& f, const std::string& typeIRI, const std::vector<std::string>& propertyIRIs) {
+    // Rows are the instances of typeIRI, in model order
+    std::vector<std::string> subjects;
+    std::unordered_map<std::string, size_t> rows;
+    autordf::Statement typeQuery;
+    typeQuery.predicate.setIri(autordf::Object::RDF_NS + "type");
+    typeQuery.object.setIri(typeIRI);
+    for (const autordf::Statement& stmt : f.find(typeQuery)) {
+        std::string subject = nodeText(stmt.subject);
+        if (rows.emplace(subject, subjects.size()).second) {
+            subjects.push_back(std::move(subject));
+        }
+    }
+
+    std::vector<Column> columns;
+    std::vector<const std::string*> texts;
+    texts.reserve(subjects.size());
+    for (const std::string& subject : subjects) {
+        texts.push_back(&subject);
+    }
+    columns.push_back(stringColumn(texts));
+
+    for (const std::string& propertyIRI : propertyIRIs) {
+        // First value found for each row
+        std::vector<std::string> values(subjects.size());
+        texts.assign(subjects.size(), nullptr);
+        bool integers = true, numbers = true, booleans = true, empty = true;
+        autordf::Statement query;
+        query.predicate.setIri(propertyIRI);
+        for (const autordf::Statement& stmt : f.find(query)) {
+            auto row = rows.find(nodeText(stmt.subject));
+            if (row == rows.end() || texts[row->second]) {
+                continue;
+            }
+            values[row->second] = nodeText(stmt.object);
+            texts[row->second] = &values[row->second];
+            ValueKind kind = valueKind(stmt.object);
+            // Integers beyond int64, as xsd:unsignedLong or xsd:integer allow, make a float64 column
+            integers = integers && kind == ValueKind::INTEGER && fitsInt64(values[row->second]);
+            numbers = numbers && (kind == ValueKind::INTEGER || kind == ValueKind::FLOAT);
+            booleans = booleans && kind == ValueKind::BOOLEAN;
+            empty = false;
+        }
+        if (empty) {
+            columns.push_back(stringColumn(texts));
+        } else if (integers) {
+            columns.push_back(numberColumn<int64_t>("int64", texts));
+        } else if (numbers) {
+            columns.push_back(numberColumn<double>("float64", texts));
+        } else if (booleans) {
+            columns.push_back(booleanColumn(texts));
+        } else {
+            columns.push_back(stringColumn(texts));
+        }
+    }
+    return columns;
+}
+}
+
+py::dict exportColumns(const autordf::Factory& f, const std::string& typeIRI, const std::vector<std::string>& propertyIRIs) {
+    std::vector<Column> columns;
+    {
+        py::gil_scoped_release release;
+        ModelLock lock(f);
+        columns = scanColumns(f, typeIRI, propertyIRIs);
+    }
+    py::dict result;
+    result["subject"] = columns[0];
+    for (size_t i = 0; i < propertyIRIs.size(); ++i) {
+        result[py::str(propertyIRIs[i])] = columns[i + 1];
+    }
+    return result;
+}
+
+void init_columns_bind(py::module_& m) {
+    py::class_<Buffer, std::shared_ptr<Buffer>>(m, "Buffer", py::buffer_protocol())
+            .def_buffer([](Buffer& b) {
+                return py::buffer_info(b.data, b.itemSize, b.format, 1, {b.size}, {b.itemSize}, true);
+            })
+            .def("__len__", [](const Buffer& b) {
+                return b.size;
+            });
+
+    py::class_<Column>(m, "Column")
+            .def_readonly("kind", &Column::kind)
+            .def_readonly("values", &Column::values)
+            .def_readonly("offsets", &Column::offsets)
+            .def_readonly("valid", &Column::valid)
+            .def("__len__", [](const Column& c) {
+                return c.valid->size;
+            });
+}
@@ -4,15 +4,23 @@
 
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 #include "autordf/Factory.h"
+#include "ModelLock.h"
 
 namespace py = pybind11;
 
+py::dict exportColumns(const autordf::Factory& f, const std::string& typeIRI, const std::vector<std::string>& propertyIRIs);
+
 void init_factory_bind(py::module_& m) {
     py::class_<autordf::Factory, autordf::Model>(m, "Factory")
             .def(py::init())
+            // Columns of the values of propertyIRIs for each instance of typeIRI, as buffers without one Python object per value
+            .def("exportColumns", &exportColumns, py::arg("typeIRI"), py::arg("propertyIRIs"))
             // used for tests only
             .def("findSize", [](const autordf::Factory& f) {
+                py::gil_scoped_release release;
+                ModelLock lock(f);
                 return f.find().size();
             });
 }
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef AUTORDF_PYBIND_MODELLOCK_H
+#define AUTORDF_PYBIND_MODELLOCK_H
+
+#include <mutex>
+
+#include <pybind11/pybind11.h>
+#include "autordf/Model.h"
+#include "autordf/Object.h"
+
+/**
+ * Serializes the accesses of Python threads to a model, once they released the GIL: neither the model storage,
+ * Factory nor notifiers are thread safe.
+ * Must be taken after the GIL is released, and released before the GIL is taken again, so that a thread waiting
+ * for the model never holds the GIL a thread using the model needs to call back Python
+ */
+class ModelLock {
+public:
+    explicit ModelLock(const autordf::Model& model) : _lock(model.accessMutex()) {}
+
+    /**
+     * Locks the model of Object::factory(), the one Object bindings read and write
+     */
+    ModelLock() : ModelLock(*autordf::Object::factory()) {}
+
+private:
+    std::unique_lock<std::recursive_mutex> _lock;
+};
+
+/**
+ * Call guard of the bindings accessing Object::factory() model: GIL is released, then model is locked
+ */
+using ModelAccess = pybind11::call_guard<pybind11::gil_scoped_release, ModelLock>;
+
+#endif //AUTORDF_PYBIND_MODELLOCK_H
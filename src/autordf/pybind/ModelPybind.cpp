@@ -3,16 +3,131 @@
 //
 
 #include <pybind11/pybind11.h>
+#include <autordf/Exception.h>
 #include <autordf/Model.h>
+#include <autordf/PropertyValue.h>
+#include "ModelLock.h"
 
 namespace py = pybind11;
 
+namespace {
+/**
+ * Node from its Python form: IRI string, "_:" prefixed blank node id, PropertyValue for literals, or None for any node
+ */
+autordf::Node toNode(const py::object& value) {
+    autordf::Node node;
+    if (value.is_none()) {
+        return node;
+    }
+    if (py::isinstance<autordf::PropertyValue>(value)) {
+        const autordf::PropertyValue& literal = value.cast<const autordf::PropertyValue&>();
+        node.setLiteral(literal, literal.lang(), literal.dataTypeIri());
+    } else {
+        std::string text = value.cast<std::string>();
+        if (text.compare(0, 2, "_:") == 0) {
+            node.setBNodeId(text.substr(2));
+        } else {
+            node.setIri(text);
+        }
+    }
+    return node;
+}
+
+py::object fromNode(const autordf::Node& node) {
+    switch (node.type()) {
+        case autordf::NodeType::RESOURCE:
+            return py::str(node.iri());
+        case autordf::NodeType::BLANK:
+            return py::str(std::string("_:") + node.bNodeId());
+        default:
+            return py::cast(autordf::PropertyValue(node.literal(), node.lang(), node.dataType()));
+    }
+}
+
+/**
+ * Python iterator over a StatementCursor: statements are read from the model as Python asks for them.
+ * The cursor is only read and freed with the model locked
+ */
+class StatementIterator {
+public:
+    StatementIterator(const autordf::Model& model, autordf::StatementCursor cursor, bool targetsOnly)
+        : _model(&model), _cursor(std::make_unique<autordf::StatementCursor>(std::move(cursor))), _targetsOnly(targetsOnly) {}
+
+    StatementIterator(StatementIterator&&) = default;
+
+    ~StatementIterator() {
+        if (_cursor) {
+            py::gil_scoped_release release;
+            ModelLock lock(*_model);
+            _cursor.reset();
+        }
+    }
+
+    py::object next() {
+        bool found;
+        {
+            py::gil_scoped_release release;
+            ModelLock lock(*_model);
+            found = _cursor->next(&_stmt);
+        }
+        if (!found) {
+            throw py::stop_iteration();
+        }
+        if (_targetsOnly) {
+            return fromNode(_stmt.object);
+        }
+        return py::make_tuple(fromNode(_stmt.subject), fromNode(_stmt.predicate), fromNode(_stmt.object));
+    }
+
+private:
+    const autordf::Model* _model;
+    std::unique_ptr<autordf::StatementCursor> _cursor;
+    autordf::Statement _stmt;
+    bool _targetsOnly;
+};
+}
+
 void init_model_bind(py::module_& m) {
+    py::register_exception<autordf::ModelChanged>(m, "ModelChanged");
+
+    py::class_<StatementIterator>(m, "StatementIterator")
+            .def("__iter__", [](py::object self) {
+                return self;
+            })
+            .def("__next__", &StatementIterator::next);
+
+    // Loading and saving release the GIL so that other Python threads keep running during I/O.
+    // Model accesses are serialized by the model lock, taken once the GIL is released
     py::class_<autordf::Model>(m, "Model")
             .def(py::init())
             // To change if we get to cpp14
-            .def("loadFromFile", static_cast<void (autordf::Model::*)(const std::string&, const std::string&)>(&autordf::Model::loadFromFile),
-                 py::arg("path"), py::arg("baseIRI") = "")
-            .def("saveToFile", &autordf::Model::saveToFile)
-            .def("addNamespacePrefix", &autordf::Model::addNamespacePrefix);
+            .def("loadFromFile", [](autordf::Model& model, const std::string& path, const std::string& baseIRI) {
+                py::gil_scoped_release release;
+                ModelLock lock(model);
+                model.loadFromFile(path, baseIRI);
+            }, py::arg("path"), py::arg("baseIRI") = "")
+            .def("saveToFile", [](autordf::Model& model, const std::string& path, const std::string& baseIRI, bool enforceRepeatable, const std::string& format) {
+                py::gil_scoped_release release;
+                ModelLock lock(model);
+                model.saveToFile(path, baseIRI, enforceRepeatable, format);
+            }, py::arg("path"), py::arg("baseIRI") = "", py::arg("enforceRepeatable") = false, py::arg("format") = "")
+            .def("addNamespacePrefix", [](autordf::Model& model, const std::string& prefix, const std::string& ns) {
+                py::gil_scoped_release release;
+                ModelLock lock(model);
+                model.addNamespacePrefix(prefix, ns);
+            })
+            // Lazy iterators: statements are read one at a time, the iterator keeps the model alive.
+            // Changing the model while iterating raises ModelChanged
+            .def("find", [](const autordf::Model& model, const py::object& subject, const py::object& predicate, const py::object& object) {
+                autordf::Statement query(toNode(subject), toNode(predicate), toNode(object));
+                py::gil_scoped_release release;
+                ModelLock lock(model);
+                return StatementIterator(model, model.findCursor(query), false);
+            }, py::arg("subject") = py::none(), py::arg("predicate") = py::none(), py::arg("object") = py::none(), py::keep_alive<0, 1>())
+            .def("findTargets", [](const autordf::Model& model, const py::object& source, const py::object& arc) {
+                autordf::Statement query(toNode(source), toNode(arc), autordf::Node());
+                py::gil_scoped_release release;
+                ModelLock lock(model);
+                return StatementIterator(model, model.findCursor(query), true);
+            }, py::arg("source"), py::arg("arc"), py::keep_alive<0, 1>());
 }
\ No newline at end of file
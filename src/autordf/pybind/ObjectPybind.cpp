@@ -7,10 +7,85 @@
 #include <pybind11/functional.h>
 #include <pybind11/operators.h>
 #include "autordf/Object.h"
+#include "autordf/Predicate.h"
+#include "autordf/PropertySnapshot.h"
+#include "ModelLock.h"
 
 namespace py = pybind11;
 
+namespace {
+/**
+ * Values of each of predicates, read with a single query on the object
+ */
+std::vector<std::vector<autordf::PropertyValue>> propertyValueLists(const autordf::Object& o, const std::vector<autordf::Predicate>& predicates, bool preserveOrdering) {
+    autordf::PropertySnapshot snapshot = o.snapshot();
+    std::vector<std::vector<autordf::PropertyValue>> valueLists;
+    valueLists.reserve(predicates.size());
+    for (const autordf::Predicate& predicate : predicates) {
+        valueLists.emplace_back(snapshot.valueList(predicate, preserveOrdering));
+    }
+    return valueLists;
+}
+
+std::vector<autordf::Predicate> predicates(const std::vector<std::string>& propertyIRIs) {
+    return std::vector<autordf::Predicate>(propertyIRIs.begin(), propertyIRIs.end());
+}
+
+/**
+ * Instances of cls, a Python subclass of Object, sharing the resources of objects.
+ * Same as cls(other=object) for each object, without going through cls constructor arguments handling. Needs the GIL
+ *
+ * @param cls if None, objects are returned as Object
+ */
+py::list wrapObjects(const py::object& cls, std::vector<autordf::Object>&& objects) {
+    if (cls.is_none()) {
+        return py::list(py::cast(std::move(objects)));
+    }
+    py::object newInstance = cls.attr("__new__");
+    py::object init = py::type::of<autordf::Object>().attr("__init__");
+    py::list wrapped(objects.size());
+    for (size_t i = 0; i < objects.size(); ++i) {
+        py::object instance = newInstance(cls);
+        init(instance, std::move(objects[i]));
+        wrapped[i] = std::move(instance);
+    }
+    return wrapped;
+}
+
+/**
+ * Values of each of predicates, read with a single query on the object.
+ * Data properties values are PropertyValue, object properties values are instances of their class
+ *
+ * @param classes for each predicate, None if it is a data property, or the class object property values are instances of
+ */
+py::list valueLists(const autordf::Object& o, const std::vector<autordf::Predicate*>& predicates,
+                    const std::vector<bool>& preserveOrdering, const std::vector<py::object>& classes) {
+    if (preserveOrdering.size() != predicates.size() || classes.size() != predicates.size()) {
+        throw py::value_error("predicates, preserveOrdering and classes must have the same length");
+    }
+    autordf::PropertySnapshot snapshot = [&o]() {
+        py::gil_scoped_release release;
+        ModelLock lock;
+        return o.snapshot();
+    }();
+    py::list lists(predicates.size());
+    for (size_t i = 0; i < predicates.size(); ++i) {
+        if (!predicates[i]) {
+            throw py::value_error("predicates must not contain None");
+        }
+        if (classes[i].is_none()) {
+            lists[i] = py::cast(snapshot.valueList(*predicates[i], preserveOrdering[i]));
+        } else {
+            lists[i] = wrapObjects(classes[i], autordf::Object::snapshotObjectList<autordf::Object>(snapshot, *predicates[i], preserveOrdering[i]));
+        }
+    }
+    return lists;
+}
+}
+
 void init_object_bind(py::module_& m) {
+    // Calls that query the model release the GIL while they run, the results are converted to Python once it is held again.
+    // As in C++, the model must still not be accessed from several threads at once
 
     // Register related exceptions
     py::register_exception<autordf::InvalidNodeType>(m, "InvalidNodeType");
@@ -22,72 +97,122 @@ void init_object_bind(py::module_& m) {
     py::class_<autordf::Object, std::shared_ptr<autordf::Object> >(m, "Object")
             // Constructors
             // TODO find a way so that setFactory error when building links to python setFactory, not cpp one
-            .def(py::init<const autordf::Uri&, const autordf::Uri&>(), py::arg("iri") = "", py::arg("rdfTypeIRI") = "")
+            .def(py::init<const autordf::Uri&, const autordf::Uri&>(), py::arg("iri") = "", py::arg("rdfTypeIRI") = "", ModelAccess())
             .def(py::init<autordf::Object const &>())
             // PropertyValue
+            // Predicate overloads come first, so that a Predicate does not match the Uri ones
+            .def("getPropertyValue", [](const autordf::Object& o, const autordf::Predicate& predicate) {
+                return o.getPropertyValue(predicate);
+            }, ModelAccess())
             .def("getPropertyValue", [](const autordf::Object& o, const autordf::Uri& uri) {
                 return o.getPropertyValue(uri);
-            }) // Do not need factory for python usages
+            }, ModelAccess()) // Do not need factory for python usages
+            .def("getOptionalPropertyValue", [](const autordf::Object& o, const autordf::Predicate& predicate) {
+                return o.getOptionalPropertyValue(predicate);
+            }, ModelAccess())
             .def("getOptionalPropertyValue", [](const autordf::Object& o, const autordf::Uri& uri) {
                 return o.getOptionalPropertyValue(uri);
-            }) // Do not need factory for python usages
-            .def("getPropertyValueList", &autordf::Object::getPropertyValueList)
-            .def("setPropertyValue", &autordf::Object::setPropertyValue)
-            .def("addPropertyValue", &autordf::Object::addPropertyValue)
-            .def("removePropertyValue", &autordf::Object::removePropertyValue)
-            .def("setPropertyValueList", &autordf::Object::setPropertyValueList)
+            }, ModelAccess()) // Do not need factory for python usages
+            .def("getPropertyValueList", static_cast<std::vector<autordf::PropertyValue> (autordf::Object::*)(const autordf::Predicate&, bool) const>(&autordf::Object::getPropertyValueList),
+                 ModelAccess())
+            .def("getPropertyValueList", static_cast<std::vector<autordf::PropertyValue> (autordf::Object::*)(const autordf::Uri&, bool) const>(&autordf::Object::getPropertyValueList),
+                 ModelAccess())
+            // Batched reads: one model query and one binding call for many values
+            .def("getPropertyValueLists", [](const autordf::Object& o, const std::vector<std::string>& propertyIRIs, bool preserveOrdering) {
+                return propertyValueLists(o, predicates(propertyIRIs), preserveOrdering);
+            }, py::arg("propertyIRIs"), py::arg("preserveOrdering") = false, ModelAccess())
+            .def("getValueLists", &valueLists, py::arg("predicates"), py::arg("preserveOrdering"), py::arg("classes"))
+            .def("setPropertyValue", &autordf::Object::setPropertyValue, ModelAccess())
+            .def("addPropertyValue", &autordf::Object::addPropertyValue, ModelAccess())
+            .def("removePropertyValue", &autordf::Object::removePropertyValue, ModelAccess())
+            .def("setPropertyValueList", &autordf::Object::setPropertyValueList, ModelAccess())
             // Reification for propertyValue
-            .def("reifiedPropertyValue", &autordf::Object::reifiedPropertyValue)
-            .def("reifyPropertyValue", &autordf::Object::reifyPropertyValue)
-            .def("unReifyPropertyValue", &autordf::Object::unReifyPropertyValue, py::arg("propertyIRI"), py::arg("val"), py::arg("keep") = true)
+            .def("reifiedPropertyValue", &autordf::Object::reifiedPropertyValue, ModelAccess())
+            .def("reifyPropertyValue", &autordf::Object::reifyPropertyValue, ModelAccess())
+            .def("unReifyPropertyValue", &autordf::Object::unReifyPropertyValue, py::arg("propertyIRI"), py::arg("val"), py::arg("keep") = true, ModelAccess())
             // Object
-            .def("getObject", &autordf::Object::getObject)
-            .def("getOptionalObject", &autordf::Object::getOptionalObject)
-            .def("getObjectList", &autordf::Object::getObjectList)
-            .def("setObject", &autordf::Object::setObject)
-            .def("addObject", &autordf::Object::addObject)
-            .def("removeObject", &autordf::Object::removeObject)
-            .def("setObjectList", &autordf::Object::setObjectList)
+            .def("getObject", static_cast<autordf::Object (autordf::Object::*)(const autordf::Predicate&) const>(&autordf::Object::getObject), ModelAccess())
+            .def("getObject", static_cast<autordf::Object (autordf::Object::*)(const autordf::Uri&) const>(&autordf::Object::getObject), ModelAccess())
+            .def("getOptionalObject", static_cast<std::optional<autordf::Object> (autordf::Object::*)(const autordf::Predicate&) const>(&autordf::Object::getOptionalObject), ModelAccess())
+            .def("getOptionalObject", static_cast<std::optional<autordf::Object> (autordf::Object::*)(const autordf::Uri&) const>(&autordf::Object::getOptionalObject), ModelAccess())
+            .def("getObjectList", static_cast<std::vector<autordf::Object> (autordf::Object::*)(const autordf::Predicate&, bool) const>(&autordf::Object::getObjectList),
+                 ModelAccess())
+            .def("getObjectList", static_cast<std::vector<autordf::Object> (autordf::Object::*)(const autordf::Uri&, bool) const>(&autordf::Object::getObjectList),
+                 ModelAccess())
+            .def("getObjectListAs", [](const autordf::Object& o, const autordf::Predicate& predicate, const py::object& cls, bool preserveOrdering) {
+                std::vector<autordf::Object> objects;
+                {
+                    py::gil_scoped_release release;
+                    ModelLock lock;
+                    objects = o.getObjectList(predicate, preserveOrdering);
+                }
+                return wrapObjects(cls, std::move(objects));
+            }, py::arg("predicate"), py::arg("cls"), py::arg("preserveOrdering") = false)
+            .def("setObject", &autordf::Object::setObject, ModelAccess())
+            .def("addObject", &autordf::Object::addObject, ModelAccess())
+            .def("removeObject", &autordf::Object::removeObject, ModelAccess())
+            .def("setObjectList", &autordf::Object::setObjectList, ModelAccess())
             // Object reification
-            .def("reifiedObject", &autordf::Object::reifiedObject)
-            .def("reifyObject", &autordf::Object::reifyObject)
-            .def("unReifyObject", &autordf::Object::unReifyObject, py::arg("propertyIRI"), py::arg("object"), py::arg("keep") = true)
+            .def("reifiedObject", &autordf::Object::reifiedObject, ModelAccess())
+            .def("reifyObject", &autordf::Object::reifyObject, ModelAccess())
+            .def("unReifyObject", &autordf::Object::unReifyObject, py::arg("propertyIRI"), py::arg("object"), py::arg("keep") = true, ModelAccess())
             // Miscalleneous functions
-            .def("writeRdfType", &autordf::Object::writeRdfType)
-            .def("getTypes", &autordf::Object::getTypes, py::arg("namespaceFilter") = "")
-            .def("isA", static_cast<bool (autordf::Object::*)(const autordf::Uri&) const>(&autordf::Object::isA))
-            .def("QName", &autordf::Object::QName)
-            .def("clone", &autordf::Object::clone, py::arg("iri") = "")
+            .def("writeRdfType", &autordf::Object::writeRdfType, ModelAccess())
+            .def("getTypes", &autordf::Object::getTypes, py::arg("namespaceFilter") = "", ModelAccess())
+            .def("isA", static_cast<bool (autordf::Object::*)(const autordf::Uri&) const>(&autordf::Object::isA), ModelAccess())
+            .def("QName", &autordf::Object::QName, ModelAccess())
+            .def("clone", &autordf::Object::clone, py::arg("iri") = "", ModelAccess())
             // requires functional to work
             // Additionally nullptr for default argument functions doesn't seem to work, so we do our "default no function argument" ourselves
             .def("cloneRecursiveStopAtResources", [](const autordf::Object* self, const autordf::Uri& iri = "") {
                 return self->cloneRecursiveStopAtResources(iri);
-            })
-            .def("cloneRecursiveStopAtResources", &autordf::Object::cloneRecursiveStopAtResources)
+            }, ModelAccess())
+            .def("cloneRecursiveStopAtResources", &autordf::Object::cloneRecursiveStopAtResources, ModelAccess())
             .def("iri", &autordf::Object::iri)
-            .def("remove", &autordf::Object::remove, py::arg("removeRecursive") = false)
+            .def("remove", &autordf::Object::remove, py::arg("removeRecursive") = false, ModelAccess())
             // we cast the set to vector because pybind doesn't seem to handle set returns properly
             .def("findSources", [](const autordf::Object* o) {
                 auto setRes = o->findSources();
                 std::vector<autordf::Object> ret(setRes.begin(), setRes.end());
                 return ret;
-            })
+            }, ModelAccess())
             .def("findTargets", [](const autordf::Object* o) {
                 auto setRes = o->findTargets();
                 std::vector<autordf::Object> ret(setRes.begin(), setRes.end());
                 return ret;
-            })
+            }, ModelAccess())
             // static functions
             .def_static("setFactory", &autordf::Object::setFactory)
             // static casts to be changed to overload cast if we move to c++ 14
-            .def_static("findByType", static_cast<std::vector<autordf::Object> (*)(const autordf::Uri&)>(&autordf::Object::findByType))
-            .def_static("findByKey", static_cast<autordf::Object (*)(const autordf::Uri&, const autordf::PropertyValue&)>(&autordf::Object::findByKey))
-            .def_static("findByKey", static_cast<autordf::Object (*)(const autordf::Uri&, const autordf::Object&)>(&autordf::Object::findByKey))
+            .def_static("findByType", static_cast<std::vector<autordf::Object> (*)(const autordf::Uri&)>(&autordf::Object::findByType),
+                        ModelAccess())
+            // Instances of cls, built in bulk rather than one cls(other=found) call per object
+            .def_static("findByTypeAs", [](const autordf::Uri& typeIRI, const py::object& cls) {
+                std::vector<autordf::Object> objects;
+                {
+                    py::gil_scoped_release release;
+                    ModelLock lock;
+                    objects = autordf::Object::findByType(typeIRI);
+                }
+                return wrapObjects(cls, std::move(objects));
+            }, py::arg("typeIRI"), py::arg("cls"))
+            .def_static("findByKey", static_cast<autordf::Object (*)(const autordf::Uri&, const autordf::PropertyValue&)>(&autordf::Object::findByKey), ModelAccess())
+            .def_static("findByKey", static_cast<autordf::Object (*)(const autordf::Uri&, const autordf::Object&)>(&autordf::Object::findByKey), ModelAccess())
             .def_static("findAll", []() {
                 auto setRes = autordf::Object::findAll(nullptr);
                 std::vector<autordf::Object> ret(setRes.begin(), setRes.end());
                 return ret;
-            })
+            }, ModelAccess())
+            // Batched reads: values of each property of propertyIRIs, for each object of objects
+            .def_static("getPropertyValueListsBatch", [](const std::vector<autordf::Object>& objects, const std::vector<std::string>& propertyIRIs, bool preserveOrdering) {
+                std::vector<autordf::Predicate> preds = predicates(propertyIRIs);
+                std::vector<std::vector<std::vector<autordf::PropertyValue>>> ret;
+                ret.reserve(objects.size());
+                for (const autordf::Object& o : objects) {
+                    ret.emplace_back(propertyValueLists(o, preds, preserveOrdering));
+                }
+                return ret;
+            }, py::arg("objects"), py::arg("propertyIRIs"), py::arg("preserveOrdering") = false, ModelAccess())
             // operators (requires operators from pybind)
             .def(pybind11::self < pybind11::self)
             .def(pybind11::self == pybind11::self);
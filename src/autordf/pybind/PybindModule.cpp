@@ -9,6 +9,7 @@ void init_uri_bind(py::module_& m);
 void init_propertyvalue_bind(py::module_& m);
 void init_object_bind(py::module_& m);
 void init_model_bind(py::module_& m);
+void init_columns_bind(py::module_& m);
 void init_factory_bind(py::module_& m);
 
 // Order is in dependency order
@@ -17,6 +18,7 @@ PYBIND11_MODULE(autordf_py, m) {
     init_i18string_bind(m);
     init_propertyvalue_bind(m);
     init_model_bind(m);
+    init_columns_bind(m);
     init_factory_bind(m);
     init_uri_bind(m);
     init_object_bind(m);
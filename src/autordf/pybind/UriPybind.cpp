@@ -5,6 +5,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/operators.h>
 #include <autordf/Uri.h>
+#include <autordf/Predicate.h>
 #include <autordf/Model.h>
 
 namespace py = pybind11;
@@ -22,4 +23,8 @@ void init_uri_bind(py::module_& m) {
             .def(pybind11::self != pybind11::self)
             .def(pybind11::self == std::string());
     py::implicitly_convertible<std::string, autordf::Uri>();
+
+    // Uri along with its node, built once: generated code keeps one per property to speed up accesses
+    py::class_<autordf::Predicate, autordf::Uri>(m, "Predicate")
+            .def(py::init<const std::string&>(), py::arg("iri"));
 }
\ No newline at end of file
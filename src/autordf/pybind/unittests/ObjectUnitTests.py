@@ -1,6 +1,7 @@
 import unittest
 import autordf_py
 import os
+import threading
 
 class TestObject(unittest.TestCase):
     def test_comparison(self):
@@ -52,6 +53,194 @@ class TestObject(unittest.TestCase):
         self.assertRaises(autordf_py.InvalidNodeType, person.getObject, "http://xmlns.com/foaf/0.1/name")
         self.assertRaises(autordf_py.PropertyNotFound, person.getObject, "http://xmlns.com/foaf/0.1/unexistingPropery")
 
+    def test_batched_accessors(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        fact.loadFromFile(os.path.dirname(os.path.abspath(__file__)) + "/foafExample.ttl", "http://xmlns.com/foaf/0.1/")
+        objs = autordf_py.Object.findByType("http://xmlns.com/foaf/0.1/Person")
+        for obj in objs:
+            if obj.getPropertyValue("http://xmlns.com/foaf/0.1/name") == "Jimmy Wales":
+                person = obj
+                break
+        values = person.getPropertyValueLists(["http://xmlns.com/foaf/0.1/name", "http://xmlns.com/foaf/0.1/nick", "http://xmlns.com/foaf/0.1/unexisting"])
+        self.assertEqual([["Jimmy Wales"], ["Jimbo"], []], values)
+        batch = autordf_py.Object.getPropertyValueListsBatch(objs, ["http://xmlns.com/foaf/0.1/name"])
+        self.assertEqual(len(objs), len(batch))
+        for obj, values in zip(objs, batch):
+            self.assertEqual(obj.getPropertyValueList("http://xmlns.com/foaf/0.1/name", False), values[0])
+
+    def test_value_lists(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        fact.loadFromFile(os.path.dirname(os.path.abspath(__file__)) + "/foafExample.ttl", "http://xmlns.com/foaf/0.1/")
+        person = [obj for obj in autordf_py.Object.findByType("http://xmlns.com/foaf/0.1/Person") if obj.getPropertyValue("http://xmlns.com/foaf/0.1/name") == "Jimmy Wales"][0]
+        name = autordf_py.Predicate("http://xmlns.com/foaf/0.1/name")
+        knows = autordf_py.Predicate("http://xmlns.com/foaf/0.1/knows")
+        unexisting = autordf_py.Predicate("http://xmlns.com/foaf/0.1/unexisting")
+
+        class Person(autordf_py.Object):
+            pass
+
+        names, known, missing, knownObjects = person.getValueLists([name, knows, unexisting, knows], [False, False, False, False], [None, Person, None, None])
+        self.assertEqual(["Jimmy Wales"], names)
+        self.assertEqual(2, len(known))
+        self.assertTrue(all(type(obj) is Person for obj in known))
+        self.assertEqual([], missing)
+        # Without a class, object property values are read as PropertyValue
+        self.assertEqual(sorted(obj.iri() for obj in known), sorted(str(value) for value in knownObjects))
+        self.assertEqual([], person.getValueLists([], [], []))
+        self.assertRaises(ValueError, person.getValueLists, [name, knows], [False], [None, None])
+        self.assertRaises(ValueError, person.getValueLists, [name], [False], [None, None])
+        self.assertRaises(ValueError, person.getValueLists, [None], [False], [None])
+
+    def test_find_by_type_as(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        fact.loadFromFile(os.path.dirname(os.path.abspath(__file__)) + "/foafExample.ttl", "http://xmlns.com/foaf/0.1/")
+
+        class Person(autordf_py.Object):
+            pass
+
+        persons = autordf_py.Object.findByTypeAs("http://xmlns.com/foaf/0.1/Person", Person)
+        self.assertEqual(3, len(persons))
+        self.assertTrue(all(type(obj) is Person for obj in persons))
+        self.assertEqual(sorted(autordf_py.Object.findByType("http://xmlns.com/foaf/0.1/Person")), sorted(persons))
+        objects = autordf_py.Object.findByTypeAs("http://xmlns.com/foaf/0.1/Person", None)
+        self.assertTrue(all(type(obj) is autordf_py.Object for obj in objects))
+        self.assertEqual(sorted(persons), sorted(objects))
+        self.assertEqual([], autordf_py.Object.findByTypeAs("http://xmlns.com/foaf/0.1/Unexisting", Person))
+
+    def test_object_list_as(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        fact.loadFromFile(os.path.dirname(os.path.abspath(__file__)) + "/foafExample.ttl", "http://xmlns.com/foaf/0.1/")
+        person = [obj for obj in autordf_py.Object.findByType("http://xmlns.com/foaf/0.1/Person") if obj.getPropertyValue("http://xmlns.com/foaf/0.1/name") == "Jimmy Wales"][0]
+        knows = autordf_py.Predicate("http://xmlns.com/foaf/0.1/knows")
+
+        class Person(autordf_py.Object):
+            pass
+
+        known = person.getObjectListAs(knows, Person)
+        self.assertEqual(2, len(known))
+        self.assertTrue(all(type(obj) is Person for obj in known))
+        self.assertEqual(sorted(person.getObjectList("http://xmlns.com/foaf/0.1/knows", False)), sorted(known))
+        objects = person.getObjectListAs(knows, None, False)
+        self.assertTrue(all(type(obj) is autordf_py.Object for obj in objects))
+        self.assertEqual(sorted(known), sorted(objects))
+        self.assertEqual([], person.getObjectListAs(autordf_py.Predicate("http://xmlns.com/foaf/0.1/unexisting"), Person))
+
+    def test_export_columns(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        fact.loadFromFile(os.path.dirname(os.path.abspath(__file__)) + "/foafExample.ttl", "http://xmlns.com/foaf/0.1/")
+        columns = fact.exportColumns("http://xmlns.com/foaf/0.1/Person", ["http://xmlns.com/foaf/0.1/name"])
+        self.assertEqual(3, len(columns["subject"]))
+        names = columns["http://xmlns.com/foaf/0.1/name"]
+        self.assertEqual("string", names.kind)
+        offsets = memoryview(names.offsets).tolist()
+        data = bytes(memoryview(names.values))
+        self.assertEqual([1, 1, 1], memoryview(names.valid).tolist())
+        self.assertEqual(["Angela Beesley", "Jimmy Criket", "Jimmy Wales"],
+                         sorted(data[offsets[i]:offsets[i + 1]].decode() for i in range(len(names))))
+
+        for i in range(3):
+            obj = autordf_py.Object("http://myuri/obj" + str(i), "http://myuri/type")
+            obj.setPropertyValue("http://myuri/count", autordf_py.PropertyValue(str(i * 10), "", "http://www.w3.org/2001/XMLSchema#integer"))
+            if i:
+                obj.setPropertyValue("http://myuri/ratio", autordf_py.PropertyValue("0.5", "", "http://www.w3.org/2001/XMLSchema#double"))
+        columns = fact.exportColumns("http://myuri/type", ["http://myuri/count", "http://myuri/ratio"])
+        counts = columns["http://myuri/count"]
+        self.assertEqual("int64", counts.kind)
+        self.assertEqual([0, 10, 20], sorted(memoryview(counts.values).tolist()))
+        ratios = columns["http://myuri/ratio"]
+        self.assertEqual("float64", ratios.kind)
+        self.assertEqual(2, sum(memoryview(ratios.valid).tolist()))
+
+        # Integers beyond int64 do not abort the export, they make a float64 column
+        for i, value in enumerate(["1", "18446744073709551615"]):
+            obj = autordf_py.Object("http://myuri/big" + str(i), "http://myuri/bigtype")
+            obj.setPropertyValue("http://myuri/size", autordf_py.PropertyValue(value, "", "http://www.w3.org/2001/XMLSchema#unsignedLong"))
+        columns = fact.exportColumns("http://myuri/bigtype", ["http://myuri/size"])
+        sizes = columns["http://myuri/size"]
+        self.assertEqual("float64", sizes.kind)
+        self.assertEqual([1.0, 18446744073709551615.0], sorted(memoryview(sizes.values).tolist()))
+
+        # Malformed literals do not abort the export either, their rows are invalid
+        for i, value in enumerate(["7", "seven", "8"]):
+            obj = autordf_py.Object("http://myuri/bad" + str(i), "http://myuri/badtype")
+            obj.setPropertyValue("http://myuri/age", autordf_py.PropertyValue(value, "", "http://www.w3.org/2001/XMLSchema#integer"))
+            obj.setPropertyValue("http://myuri/adult", autordf_py.PropertyValue("yes" if i else "true", "", "http://www.w3.org/2001/XMLSchema#boolean"))
+        columns = fact.exportColumns("http://myuri/badtype", ["http://myuri/age", "http://myuri/adult"])
+        subjects = columns["subject"]
+        subjectOffsets = memoryview(subjects.offsets).tolist()
+        subjectData = bytes(memoryview(subjects.values))
+        rows = [subjectData[subjectOffsets[i]:subjectOffsets[i + 1]].decode() for i in range(len(subjects))]
+        ages = columns["http://myuri/age"]
+        self.assertEqual("int64", ages.kind)
+        agesByRow = dict(zip(rows, zip(memoryview(ages.valid).tolist(), memoryview(ages.values).tolist())))
+        self.assertEqual((1, 7), agesByRow["http://myuri/bad0"])
+        self.assertEqual(0, agesByRow["http://myuri/bad1"][0])
+        self.assertEqual((1, 8), agesByRow["http://myuri/bad2"])
+        adults = columns["http://myuri/adult"]
+        self.assertEqual("bool", adults.kind)
+        self.assertEqual([0, 0, 1], sorted(memoryview(adults.valid).tolist()))
+
+    def test_model_iterators(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        fact.loadFromFile(os.path.dirname(os.path.abspath(__file__)) + "/foafExample.ttl", "http://xmlns.com/foaf/0.1/")
+        names = sorted(str(o) for s, p, o in fact.find(predicate="http://xmlns.com/foaf/0.1/name"))
+        self.assertEqual(["Angela Beesley", "Jimmy Criket", "Jimmy Wales"], names)
+        self.assertEqual(fact.findSize(), sum(1 for _ in fact.find()))
+        targets = list(fact.findTargets("http://jimmycricket.com/me", "http://www.w3.org/1999/02/22-rdf-syntax-ns#type"))
+        self.assertEqual(["http://xmlns.com/foaf/0.1/Person"], targets)
+
+        statements = fact.find()
+        next(statements)
+        autordf_py.Object("http://myuri/myobject").setPropertyValue("http://myuri/myprop", "value")
+        self.assertRaises(autordf_py.ModelChanged, next, statements)
+
+    def test_threads(self):
+        fact = autordf_py.Factory()
+        autordf_py.Object.setFactory(fact)
+        fact.loadFromFile(os.path.dirname(os.path.abspath(__file__)) + "/foafExample.ttl", "http://xmlns.com/foaf/0.1/")
+        name = autordf_py.Predicate("http://xmlns.com/foaf/0.1/name")
+        errors = []
+
+        def write(i):
+            try:
+                obj = autordf_py.Object("http://testns/writer%d" % i, "http://testns/Writer")
+                for j in range(200):
+                    obj.setPropertyValue("http://testns/count", str(j))
+                    obj.addPropertyValue("http://testns/seen", str(j), False)
+            except Exception as e:
+                errors.append(e)
+
+        def read():
+            try:
+                for j in range(200):
+                    persons = autordf_py.Object.findByType("http://xmlns.com/foaf/0.1/Person")
+                    if len(persons) != 3:
+                        errors.append("%d persons" % len(persons))
+                    for person in persons:
+                        person.getPropertyValueList("http://xmlns.com/foaf/0.1/name", False)
+                        person.getValueLists([name], [False], [None])
+                    autordf_py.Object.findByType("http://testns/Writer")
+            except Exception as e:
+                errors.append(e)
+
+        threads = [threading.Thread(target=write, args=(i,)) for i in range(4)] + [threading.Thread(target=read) for i in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual([], errors)
+        writers = autordf_py.Object.findByType("http://testns/Writer")
+        self.assertEqual(4, len(writers))
+        for writer in writers:
+            self.assertEqual(["199"], writer.getPropertyValueList("http://testns/count", False))
+            self.assertEqual(200, len(writer.getPropertyValueList("http://testns/seen", False)))
+
     def test_delayed_typewriting(self):
         fact = autordf_py.Factory()
         autordf_py.Object.setFactory(fact)
@@ -4,6 +4,7 @@
 #include <boost/filesystem.hpp>
 #include <autordf/Uri.h>
 
+#include "autordf/Exception.h"
 #include "autordf/Model.h"
 
 using namespace autordf;
@@ -56,6 +57,210 @@ TEST(_01_Model, SearchByPredicate) {
     ASSERT_EQ(size_t{3}, stmtList.size());
 }
 
+TEST(_01_Model, Cursor) {
+    Model ts;
+    ts.loadFromFile(boost::filesystem::path(__FILE__).parent_path().string() + "/foafExample.ttl");
+
+    Statement req;
+    req.predicate.setIri("http://xmlns.com/foaf/0.1/name");
+    StatementCursor cursor = ts.findCursor(req);
+    Statement stmt;
+    size_t count = 0;
+    while ( cursor.next(&stmt) ) {
+        ASSERT_STREQ("http://xmlns.com/foaf/0.1/name", stmt.predicate.iri());
+        ++count;
+    }
+    ASSERT_EQ(size_t{3}, count);
+    ASSERT_FALSE(cursor.next(&stmt));
+
+    StatementCursor all = ts.findCursor();
+    ASSERT_TRUE(all.next(&stmt));
+    Statement added(Node().setIri("http://subject"), Node().setIri("http://predicate"), Node().setLiteral("value"));
+    ts.add(&added);
+    ASSERT_THROW(all.next(&stmt), ModelChanged);
+
+    // Removals while cursors are open invalidate them as well
+    StatementCursor first = ts.findCursor();
+    StatementCursor second = ts.findCursor(req);
+    ASSERT_TRUE(first.next(&stmt));
+    ASSERT_TRUE(second.next(&stmt));
+    ts.remove(&added);
+    ASSERT_THROW(first.next(&stmt), ModelChanged);
+    ASSERT_THROW(second.next(&stmt), ModelChanged);
+
+    StatementCursor third = ts.findCursor();
+    ASSERT_TRUE(third.next(&stmt));
+    ASSERT_EQ(size_t{3}, ts.clear(req));
+    ASSERT_THROW(third.next(&stmt), ModelChanged);
+    ASSERT_TRUE(ts.find(req).empty());
+}
+
+TEST(_01_Model, CopyFrom) {
+    Model source;
+    source.loadFromFile(boost::filesystem::path(__FILE__).parent_path().string() + "/foafExample.ttl");
+
+    Model all;
+    all.mergeFrom(source);
+    ASSERT_EQ(source.find().size(), all.find().size());
+    ASSERT_EQ("http://xmlns.com/foaf/0.1/", all.prefixToNs("foaf"));
+
+    // Copied blank nodes are not the ones of the source
+    Statement names;
+    names.predicate.setIri("http://xmlns.com/foaf/0.1/name");
+    for ( const Statement& stmt : all.find(names) ) {
+        if ( stmt.subject.type() == NodeType::BLANK ) {
+            Statement query;
+            query.subject = stmt.subject;
+            ASSERT_TRUE(source.find(query).empty());
+            ASSERT_FALSE(all.find(query).empty());
+        }
+    }
+
+    // A blank node copied by two calls sharing their ids is the same
+    Model part;
+    std::map<std::string, std::string> blankNodeIds;
+    ASSERT_EQ(size_t{3}, part.copyFrom(source, names, &blankNodeIds));
+    for ( const Statement& stmt : source.find(names) ) {
+        if ( stmt.subject.type() == NodeType::BLANK ) {
+            Statement query;
+            query.subject = stmt.subject;
+            size_t count = source.find(query).size();
+            ASSERT_EQ(count, part.copyFrom(source, query, &blankNodeIds));
+            Statement copied;
+            copied.subject.setBNodeId(blankNodeIds.at(stmt.subject.bNodeId()));
+            ASSERT_EQ(count, part.find(copied).size());
+        }
+    }
+}
+
+TEST(_01_Model, NamedGraphs) {
+    Model ts(true);
+    Node graph1, graph2;
+    graph1.setIri("http://mydomain/graph1");
+    graph2.setIri("http://mydomain/graph2");
+    ts.loadGraphFromFile(graph1, boost::filesystem::path(__FILE__).parent_path().string() + "/example1.ttl");
+    ts.loadGraphFromFile(graph2, boost::filesystem::path(__FILE__).parent_path().string() + "/foafExample.ttl");
+    size_t foafCount = ts.find().size() - 4;
+
+    Statement inGraph1;
+    inGraph1.graph = graph1;
+    ASSERT_EQ(size_t{4}, ts.find(inGraph1).size());
+    for ( const Statement& stmt : ts.find(inGraph1) ) {
+        ASSERT_STREQ("http://mydomain/graph1", stmt.graph.iri());
+    }
+
+    // The same statement in the default graph and in a named graph are two statements
+    Statement st;
+    st.subject.setIri("http://mydomain/me");
+    st.predicate.setIri("http://mydomain/town");
+    st.object.setLiteral("Fabien", "fr");
+    Statement stInGraph1(st.subject, st.predicate, st.object, graph1);
+    ts.add(&stInGraph1);
+    Statement stInDefault(st);
+    ts.add(&stInDefault);
+    ASSERT_EQ(size_t{2}, ts.find(st).size());
+    ASSERT_EQ(size_t{5}, ts.find(inGraph1).size());
+
+    ASSERT_EQ(size_t{5}, ts.dropGraph(graph1));
+    ASSERT_TRUE(ts.find(inGraph1).empty());
+    ASSERT_EQ(size_t{1}, ts.find(st).size());
+    ASSERT_EQ(foafCount + 1, ts.find().size());
+    ASSERT_EQ(size_t{0}, ts.dropGraph(graph1));
+
+    // Statements that name their own graph stay in it
+    Model own(true);
+    Node graph3;
+    graph3.setIri("http://mydomain/graph3");
+    const char *nquads = "<http://mydomain/s> <http://mydomain/p> \"o1\" <http://mydomain/graph2> .\n"
+                         "<http://mydomain/s> <http://mydomain/p> \"o2\" .\n";
+    own.loadGraphFromMemory(graph3, nquads, "nquads");
+    Statement inGraph3;
+    inGraph3.graph = graph3;
+    ASSERT_EQ(size_t{1}, own.find(inGraph3).size());
+    Statement inOwnGraph2;
+    inOwnGraph2.graph = graph2;
+    ASSERT_EQ(size_t{1}, own.find(inOwnGraph2).size());
+
+    // Graphs are saved and read back
+#if defined(USE_REDLAND)
+    // Older raptor versions have no TriG serializer
+    const std::vector<const char *> formats = {"nquads"};
+#else
+    const std::vector<const char *> formats = {"nquads", "trig"};
+#endif
+    for ( const char *format : formats ) {
+        std::shared_ptr<std::string> data = ts.saveToMemory(format);
+        Model n;
+        n.loadFromMemory(data->c_str(), format);
+        Statement inGraph2;
+        inGraph2.graph = graph2;
+        ASSERT_EQ(foafCount, n.find(inGraph2).size());
+        ASSERT_EQ(foafCount + 1, n.find().size());
+    }
+}
+
+namespace {
+class CountingNotifier : public notification::ANotifier {
+public:
+    size_t removedCount = 0;
+    size_t aggregations = 0;
+
+    void added(const Statement&) override {}
+    void removed(const Statement&) override { ++removedCount; }
+
+private:
+    void aggregationFinished() override { ++aggregations; }
+};
+
+class DerivedDefaultNotifier : public notification::DefaultNotifier {
+public:
+    size_t removedCount = 0;
+
+    void removed(const Statement&) override { ++removedCount; }
+};
+}
+
+TEST(_01_Model, Clear) {
+    Model ts;
+    Node ontology;
+    ontology.setIri("http://mydomain/ontology");
+    ts.loadGraphFromFile(ontology, boost::filesystem::path(__FILE__).parent_path().string() + "/example1.ttl");
+    ts.loadFromFile(boost::filesystem::path(__FILE__).parent_path().string() + "/foafExample.ttl");
+    size_t jobCount = ts.find().size() - 4;
+
+    StatementCursor cursor = ts.findCursor();
+    ASSERT_EQ(jobCount, ts.clear(ontology));
+    Statement stmt;
+    ASSERT_THROW(cursor.next(&stmt), ModelChanged);
+    ASSERT_EQ(size_t{4}, ts.find().size());
+    ASSERT_EQ("http://xmlns.com/foaf/0.1/", ts.prefixToNs("foaf"));
+
+    // Notifications of a clear are aggregated
+    auto notifier = std::make_shared<CountingNotifier>();
+    ts.setNotifier(notifier);
+    ts.loadFromFile(boost::filesystem::path(__FILE__).parent_path().string() + "/foafExample.ttl");
+    Statement names;
+    names.predicate.setIri("http://xmlns.com/foaf/0.1/name");
+    size_t namesCount = ts.find(names).size();
+    ASSERT_EQ(namesCount, ts.clear(names));
+    ASSERT_TRUE(ts.find(names).empty());
+    ASSERT_EQ(namesCount, notifier->removedCount);
+    ASSERT_EQ(size_t{1}, notifier->aggregations);
+
+    ASSERT_EQ(jobCount - namesCount + 4, ts.clear());
+    ASSERT_TRUE(ts.find().empty());
+    ASSERT_EQ(jobCount + 4, notifier->removedCount);
+    ASSERT_EQ(size_t{2}, notifier->aggregations);
+
+    // Classes derived from the default notifier are notified too
+    auto derived = std::make_shared<DerivedDefaultNotifier>();
+    ts.setNotifier(derived);
+    ts.loadFromFile(boost::filesystem::path(__FILE__).parent_path().string() + "/foafExample.ttl");
+    size_t foafCount = ts.find().size();
+    ASSERT_EQ(foafCount, ts.clear());
+    ASSERT_EQ(foafCount, derived->removedCount);
+}
+
 TEST(_01_Model, SearchSubject) {
     Model ts;
     ts.loadFromFile(boost::filesystem::path(__FILE__).parent_path().string() + "/example1.ttl");
@@ -41,6 +41,22 @@ TEST(_02_LoadSave, AllProperties) {
 
     Resource r = f.createIRIResource("http://jimmycricket.com/me");
     ASSERT_EQ(size_t{2}, r.getPropertyValues()->size());
+
+    // Values are appended to the provided vector
+    std::vector<Property> values;
+    r.getPropertyValues(&values);
+    ASSERT_EQ(size_t{2}, values.size());
+    r.getPropertyValues("http://xmlns.com/foaf/0.1/name", &values);
+    ASSERT_EQ(size_t{3}, values.size());
+    ASSERT_EQ("http://xmlns.com/foaf/0.1/name", values.back().iri());
+
+    // Values read at once share their IRI
+    values.clear();
+    r.getPropertyValues("http://xmlns.com/foaf/0.1/name", &values);
+    r.getPropertyValues("http://xmlns.com/foaf/0.1/name", &values);
+    ASSERT_EQ(size_t{2}, values.size());
+    ASSERT_EQ(values.front().iri(), values.back().iri());
+    ASSERT_NE(&values.front().iri(), &values.back().iri());
 }
 
 TEST(_02_LoadSave, loadPerson) {
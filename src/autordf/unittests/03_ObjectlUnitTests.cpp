@@ -56,6 +56,83 @@ TEST(_03_Object, QName) {
     ASSERT_EQ("my:thing", o.QName());
 }
 
+TEST(_03_Object, QNameLongestNamespace) {
+    Factory f;
+    Object::setFactory(&f);
+
+    f.addNamespacePrefix("my", "http://my/");
+    f.addNamespacePrefix("sub", "http://my/sub/");
+    f.addNamespacePrefix("alias", "http://my/sub/");
+    f.addNamespacePrefix("other", "http://other/");
+
+    ASSERT_EQ("my:thing", Object("http://my/thing").QName());
+    ASSERT_EQ("alias:thing", Object("http://my/sub/thing").QName());
+    ASSERT_EQ("http://unknown/thing", Object("http://unknown/thing").QName());
+    ASSERT_EQ("alias", f.iriPrefix("http://my/sub/thing"));
+    ASSERT_EQ("", f.iriPrefix("http://unknown/thing"));
+    ASSERT_EQ("alias", f.nsToPrefix("http://my/sub/"));
+    ASSERT_EQ("other", f.nsToPrefix("http://other/"));
+    ASSERT_THROW(f.nsToPrefix("http://my/sub"), std::out_of_range);
+}
+
+TEST(_03_Object, PredicateAccessors) {
+    Factory f;
+    Object::setFactory(&f);
+
+    static const Predicate name("http://my/name");
+    static const Predicate knows("http://my/knows");
+
+    Object o("http://my/o");
+    o.setPropertyValue(name, PropertyValue("John"));
+    o.addObject(knows, Object("http://my/a"), false);
+    o.addObject(knows, Object("http://my/b"), false);
+
+    ASSERT_EQ("http://my/name", std::string(name));
+    ASSERT_EQ("John", o.getPropertyValue(name));
+    ASSERT_EQ(1, o.getPropertyValueList(name, false).size());
+    ASSERT_EQ(2, o.getObjectList(knows, false).size());
+    ASSERT_FALSE(o.getOptionalPropertyValue(Predicate("http://my/missing")));
+    ASSERT_FALSE(o.getOptionalObject(Predicate("http://my/missing")));
+    ASSERT_THROW(Predicate(""), InvalidIRI);
+}
+
+TEST(_03_Object, Snapshot) {
+    Factory f;
+    Object::setFactory(&f);
+
+    static const Predicate name("http://my/name");
+    static const Predicate ordered("http://my/ordered");
+    static const Predicate knows("http://my/knows");
+    static const Predicate missing("http://my/missing");
+
+    Object o("http://my/o");
+    o.setPropertyValue(name, PropertyValue("John"));
+    for ( long long i : {3, 1, 2} ) {
+        o.addPropertyValue(ordered, PropertyValue().set<cvt::RdfTypeEnum::xsd_integer>(i), true);
+    }
+    o.addObject(knows, Object("http://my/a"), false);
+    o.addObject(knows, Object("http://my/b"), false);
+
+    PropertySnapshot snapshot = o.snapshot();
+    ASSERT_EQ("John", snapshot.value(name).value());
+    ASSERT_EQ(nullptr, snapshot.optionalValue(missing));
+    ASSERT_THROW(snapshot.value(missing), PropertyNotFound);
+    ASSERT_TRUE(snapshot.values(missing, true).empty());
+    ASSERT_EQ(2, snapshot.values(knows, false).size());
+    ASSERT_THROW(snapshot.values(knows, true), CannotPreserveOrder);
+
+    std::vector<long long> values = snapshot.valueList<cvt::RdfTypeEnum::xsd_integer, long long>(ordered, true);
+    ASSERT_EQ((o.getValueListImpl<cvt::RdfTypeEnum::xsd_integer, long long>(ordered, true)), values);
+    ASSERT_EQ(std::vector<long long>({3, 1, 2}), values);
+
+    // Snapshot does not follow model changes
+    o.setPropertyValue(name, PropertyValue("Jack"));
+    ASSERT_EQ("John", snapshot.value(name).value());
+
+    // Predicates built after the snapshot find their values too
+    ASSERT_EQ(2, snapshot.values(Predicate("http://my/knows"), false).size());
+}
+
 TEST(_03_Object, Copy) {
     Factory f;
     Object::setFactory(&f);
@@ -510,6 +587,44 @@ TEST(_03_Object, cloneReification) {
     ASSERT_TRUE(clone.reifiedPropertyValue("http://myprop1", "1").get());
 }
 
+TEST(_03_Object, cloneRecursiveStopAtResourcesGraph) {
+    Factory f;
+    Object::setFactory(&f);
+
+    Object obj("http://my/object", "http://my/type");
+    Object child;
+    child.addPropertyValue("http://myprop", "child", false);
+    Object shared;
+    shared.addPropertyValue("http://myprop", "shared", false);
+    child.addObject("http://shared", shared, false);
+    obj.addObject("http://child", child, false);
+    obj.addObject("http://shared", shared, false);
+    Object skipped;
+    skipped.addPropertyValue("http://myprop", "skipped", false);
+    obj.addObject("http://skipped", skipped, false);
+    obj.setObjectList("http://list", {Object("http://my/a"), Object("http://my/b"), Object("http://my/c")}, true);
+
+    Object clone = obj.cloneRecursiveStopAtResources("http://my/object2", [](const Object&, const std::string& sourcePredicateIri, const Object*) {
+        return sourcePredicateIri == "http://skipped";
+    });
+
+    ASSERT_TRUE(clone.isA("http://my/type"));
+    Object childClone = clone.getObject("http://child");
+    ASSERT_NE(child, childClone);
+    ASSERT_EQ("child", childClone.getPropertyValue("http://myprop"));
+    // Reached twice, cloned once
+    Object sharedClone = clone.getObject("http://shared");
+    ASSERT_NE(shared, sharedClone);
+    ASSERT_EQ(sharedClone, childClone.getObject("http://shared"));
+    ASSERT_EQ("shared", sharedClone.getPropertyValue("http://myprop"));
+    ASSERT_FALSE(clone.getOptionalObject("http://skipped"));
+    // Ordered list is reified, copied along with its order
+    ASSERT_EQ(obj.getObjectList("http://list", true), clone.getObjectList("http://list", true));
+    // Original is untouched
+    ASSERT_EQ(child, obj.getObject("http://child"));
+    ASSERT_EQ(size_t{3}, obj.getObjectList("http://list", true).size());
+}
+
 TEST(_03_Object, cloneReificationViaStandardClone) {
     Factory f;
     Object::setFactory(&f);
@@ -582,6 +697,44 @@ TEST(_03_Object, removeObjectRecursive2) {
     EXPECT_TRUE(f.find().empty()) << debugInfo.str();
 }
 
+TEST(_03_Object, removeObjectRecursiveDeepAndShared) {
+    Factory f;
+    Object::setFactory(&f);
+
+    Object obj("http://testns/myobject");
+    Object other("http://testns/other");
+
+    // Long blank node chain, removed without recursing
+    Object last = obj;
+    for (int i = 0; i < 20000; ++i) {
+        Object bnode;
+        bnode.addPropertyValue("http://property", "val", false);
+        last.addObject("http://next", bnode, false);
+        last = bnode;
+    }
+
+    // Blank node reached twice from obj, removed
+    Object diamond;
+    diamond.addPropertyValue("http://property", "diamond", false);
+    Object left, right;
+    left.addObject("http://next", diamond, false);
+    right.addObject("http://next", diamond, false);
+    obj.addObject("http://left", left, false);
+    obj.addObject("http://right", right, false);
+
+    // Blank node also referenced by another object, kept
+    Object shared;
+    shared.addPropertyValue("http://property", "shared", false);
+    obj.addObject("http://shared", shared, false);
+    other.addObject("http://shared", shared, false);
+
+    obj.remove(true);
+
+    ASSERT_EQ(size_t{2}, f.find().size());
+    ASSERT_EQ(shared, other.getObject("http://shared"));
+    ASSERT_EQ("shared", shared.getPropertyValue("http://property"));
+}
+
 TEST(_03_Object, replaceObject) {
     Factory f;
     f.addNamespacePrefix("rdf", Object::RDF_NS);
@@ -1,3 +1,7 @@
+#include <chrono>
+#include <cmath>
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include <boost/filesystem.hpp>
@@ -54,6 +58,40 @@ TEST(_04_cvt, xsd_to_cpp) {
     // Check invalid data float stored where int expected
     ASSERT_THROW((toCpp<short, RdfTypeEnum::xsd_short>::val("44.03")), autordf::DataConvertionFailure);
 
+    // Check xsd lexical spaces
+    ASSERT_EQ(5, (toCpp<long long int, RdfTypeEnum::xsd_integer>::val("+5")));
+    ASSERT_THROW((toCpp<long long int, RdfTypeEnum::xsd_integer>::val("1e5")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<long long int, RdfTypeEnum::xsd_integer>::val("0x10")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<long long int, RdfTypeEnum::xsd_integer>::val("-")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<long long int, RdfTypeEnum::xsd_integer>::val("1 2")), autordf::DataConvertionFailure);
+    ASSERT_EQ(0.5, (toCpp<double, RdfTypeEnum::xsd_decimal>::val(".5")));
+    ASSERT_EQ(5, (toCpp<double, RdfTypeEnum::xsd_decimal>::val("+5.")));
+    ASSERT_EQ(1e5, (toCpp<double, RdfTypeEnum::xsd_double>::val("1E5")));
+    ASSERT_THROW((toCpp<double, RdfTypeEnum::xsd_double>::val("1e")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<double, RdfTypeEnum::xsd_double>::val(".")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<double, RdfTypeEnum::xsd_decimal>::val("INF")), autordf::DataConvertionFailure);
+    ASSERT_EQ(std::numeric_limits<double>::infinity(), (toCpp<double, RdfTypeEnum::xsd_double>::val("INF")));
+    ASSERT_EQ(-std::numeric_limits<float>::infinity(), (toCpp<float, RdfTypeEnum::xsd_float>::val("-INF")));
+    ASSERT_TRUE(std::isnan(toCpp<double, RdfTypeEnum::xsd_double>::val("NaN")));
+    ASSERT_THROW((toCpp<double, RdfTypeEnum::xsd_double>::val("-NaN")), autordf::DataConvertionFailure);
+    ASSERT_EQ(0, (toCpp<float, RdfTypeEnum::xsd_float>::val("1e-400")));
+    ASSERT_THROW((toCpp<double, RdfTypeEnum::xsd_double>::val("1e400")), autordf::DataConvertionFailure);
+
+    // Check ranges of xsd types
+    ASSERT_EQ(LLUINT{0}, (toCpp<long long unsigned int, RdfTypeEnum::xsd_nonNegativeInteger>::val("-0")));
+    ASSERT_THROW((toCpp<long long unsigned int, RdfTypeEnum::xsd_nonNegativeInteger>::val("-210")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<long long unsigned int, RdfTypeEnum::xsd_positiveInteger>::val("0")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<long long int, RdfTypeEnum::xsd_negativeInteger>::val("0")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<long long int, RdfTypeEnum::xsd_nonPositiveInteger>::val("1")), autordf::DataConvertionFailure);
+    ASSERT_EQ(LLINT{-9223372036854775807LL - 1}, (toCpp<long long int, RdfTypeEnum::xsd_long>::val("-9223372036854775808")));
+    ASSERT_THROW((toCpp<long long int, RdfTypeEnum::xsd_long>::val("9223372036854775808")), autordf::DataConvertionFailure);
+    ASSERT_EQ(LINT{-2147483648L}, (toCpp<long int, RdfTypeEnum::xsd_int>::val("-2147483648")));
+    ASSERT_THROW((toCpp<long int, RdfTypeEnum::xsd_int>::val("2147483648")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<unsigned short, RdfTypeEnum::xsd_unsignedShort>::val("65536")), autordf::DataConvertionFailure);
+    ASSERT_EQ(char{-128}, (toCpp<char, RdfTypeEnum::xsd_byte>::val("-128")));
+    ASSERT_THROW((toCpp<char, RdfTypeEnum::xsd_byte>::val("128")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<unsigned char, RdfTypeEnum::xsd_unsignedByte>::val("256")), autordf::DataConvertionFailure);
+
     // Check internationalized string and that lang matters in comparison
     ASSERT_EQ(autordf::I18String("date of birth", "en"), (toCpp<autordf::I18String, RdfTypeEnum::rdf_langString>::val(autordf::PropertyValue("date of birth", "en"))));
     ASSERT_NE(autordf::I18String("date of birth", "fr"), (toCpp<autordf::I18String, RdfTypeEnum::rdf_langString>::val(autordf::PropertyValue("date of birth", "en"))));
@@ -83,12 +121,111 @@ TEST(_04_cvt, cpp_to_xsd) {
     ASSERT_EQ("0.5", (toRdf<double, RdfTypeEnum::xsd_decimal>::val(0.5)));
     ASSERT_EQ("0.5", (toRdf<float, RdfTypeEnum::xsd_float>::val(0.5)));
     ASSERT_EQ("0.5", (toRdf<double, RdfTypeEnum::xsd_double>::val(0.5)));
+
+    // Same output as std::ostream default formatting
+    ASSERT_EQ("0.3", (toRdf<double, RdfTypeEnum::xsd_double>::val(0.1 + 0.2)));
+    ASSERT_EQ("1e+06", (toRdf<double, RdfTypeEnum::xsd_decimal>::val(1e6)));
+    ASSERT_EQ("1.23457e-05", (toRdf<double, RdfTypeEnum::xsd_double>::val(0.0000123456789)));
+    ASSERT_EQ("-inf", (toRdf<float, RdfTypeEnum::xsd_float>::val(-std::numeric_limits<float>::infinity())));
+    ASSERT_EQ("-9223372036854775808", (toRdf<long long int, RdfTypeEnum::xsd_long>::val(std::numeric_limits<long long int>::min())));
+    ASSERT_EQ("18446744073709551615", (toRdf<long long unsigned int, RdfTypeEnum::xsd_unsignedLong>::val(std::numeric_limits<long long unsigned int>::max())));
     ASSERT_EQ("2002-01-20T23:59:59.001000Z", (toRdf<boost::posix_time::ptime, RdfTypeEnum::xsd_dateTime>::val(boost::posix_time::time_from_string("2002-01-20 23:59:59.001"))));
     ASSERT_EQ("2002-01-20T23:59:59.001000Z", (toRdf<boost::posix_time::ptime, RdfTypeEnum::xsd_dateTimeStamp>::val(boost::posix_time::time_from_string("2002-01-20 23:59:59.001"))));
 }
 
-// This is cuurently noot supported by boost
-TEST(_04_cvt, DISABLED_boostbugs) {
-    // This example taken from http://www.w3.org/TR/xmlschema-2/#dateTime fails :-(
-    ASSERT_EQ("2002-Oct-10 17:00:00", boost::posix_time::to_simple_string(toCpp<boost::posix_time::ptime, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T12:00:00-05:00")));
-}
\ No newline at end of file
+TEST(_04_cvt, numeric_round_trip) {
+    for (double value: {0.5, -1e6, 1e-5, 123456., std::numeric_limits<double>::infinity()}) {
+        const std::string rdf = toRdf<double, RdfTypeEnum::xsd_double>::val(value);
+        ASSERT_EQ(rdf, (toRdf<double, RdfTypeEnum::xsd_double>::val(toCpp<double, RdfTypeEnum::xsd_double>::val(rdf))));
+    }
+    for (long long int value: {0LL, -210LL, std::numeric_limits<long long int>::min(), std::numeric_limits<long long int>::max()}) {
+        ASSERT_EQ(value, (toCpp<long long int, RdfTypeEnum::xsd_integer>::val(toRdf<long long int, RdfTypeEnum::xsd_integer>::val(value))));
+    }
+}
+
+// Not a real test: prints conversion throughput, to be compared when modifying conversions
+TEST(_04_cvt, benchmark) {
+    const int ITERATIONS = 200000;
+    auto measure = [](const char *name, auto&& conversion) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            conversion(i);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << elapsed.count() / ITERATIONS << " ns per conversion" << std::endl;
+    };
+
+    const std::string integer = "-1234567";
+    const std::string decimal = "-1234.567";
+    long long int integerSum = 0;
+    double doubleSum = 0;
+    size_t size = 0;
+    measure("xsd:integer to long long", [&](int) { integerSum += toCpp<long long int, RdfTypeEnum::xsd_integer>::val(integer); });
+    measure("xsd:double to double", [&](int) { doubleSum += toCpp<double, RdfTypeEnum::xsd_double>::val(decimal); });
+    measure("long long to xsd:integer", [&](int i) { size += toRdf<long long int, RdfTypeEnum::xsd_integer>::val(i).size(); });
+    measure("double to xsd:double", [&](int i) { size += toRdf<double, RdfTypeEnum::xsd_double>::val(i / 7.).size(); });
+
+    ASSERT_EQ(-1234567LL * ITERATIONS, integerSum);
+    ASSERT_NEAR(-1234.567 * ITERATIONS, doubleSum, 1);
+    ASSERT_LT(0, size);
+}
+
+TEST(_04_cvt, dateTime) {
+    using namespace boost::posix_time;
+    // This example taken from http://www.w3.org/TR/xmlschema-2/#dateTime
+    ASSERT_EQ("2002-Oct-10 17:00:00", to_simple_string(toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T12:00:00-05:00")));
+    ASSERT_EQ("2002-Oct-10 06:30:00", to_simple_string(toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T12:00:00+05:30")));
+    ASSERT_EQ("2002-Oct-11 00:00:00", to_simple_string(toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T24:00:00")));
+    ASSERT_EQ("2002-Oct-10 12:00:00.123456", to_simple_string(toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val(" 2002-10-10T12:00:00.1234567Z ")));
+    ASSERT_EQ("2004-Feb-29 00:00:00", to_simple_string(toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2004-02-29")));
+    ASSERT_THROW((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-02-29T12:00:00")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-1-10T12:00:00")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T12:00:00Zjunk")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T12:00:00+15:00")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T12:00:00.Z")), autordf::DataConvertionFailure);
+
+    ASSERT_EQ("not-a-date-time", (toRdf<ptime, RdfTypeEnum::xsd_dateTime>::val(ptime())));
+    ASSERT_TRUE((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("not-a-date-time").is_not_a_date_time()));
+
+    // std::chrono mapping
+    using Microseconds = std::chrono::sys_time<std::chrono::microseconds>;
+    using Seconds = std::chrono::sys_seconds;
+    const Microseconds chronoTime = std::chrono::sys_days(std::chrono::year(2002) / 10 / 10) + std::chrono::hours(17) + std::chrono::microseconds(1000);
+    ASSERT_EQ(chronoTime, (toCpp<Microseconds, RdfTypeEnum::xsd_dateTime>::val("2002-10-10T12:00:00.001-05:00")));
+    ASSERT_EQ("2002-10-10T17:00:00.001000Z", (toRdf<Microseconds, RdfTypeEnum::xsd_dateTimeStamp>::val(chronoTime)));
+    ASSERT_EQ("1969-12-31T23:59:59Z", (toRdf<Seconds, RdfTypeEnum::xsd_dateTime>::val(Seconds(std::chrono::seconds(-1)))));
+    ASSERT_EQ("0800-01-01T00:00:00Z", (toRdf<Seconds, RdfTypeEnum::xsd_dateTime>::val(toCpp<Seconds, RdfTypeEnum::xsd_dateTime>::val("0800-01-01T00:00:00"))));
+    ASSERT_EQ("32767-01-01T00:00:00Z", (toRdf<Seconds, RdfTypeEnum::xsd_dateTime>::val(toCpp<Seconds, RdfTypeEnum::xsd_dateTime>::val("32767-01-01T00:00:00"))));
+    ASSERT_THROW((toCpp<Seconds, RdfTypeEnum::xsd_dateTime>::val("32768-01-01T00:00:00")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<Seconds, RdfTypeEnum::xsd_dateTime>::val("-32768-01-01T00:00:00")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<Seconds, RdfTypeEnum::xsd_dateTime>::val("123456789-01-01T00:00:00")), autordf::DataConvertionFailure);
+
+    // Time zone offset moving the date out of boost range
+    ASSERT_THROW((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("9999-12-31T23:00:00-05:00")), autordf::DataConvertionFailure);
+    ASSERT_THROW((toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("1400-01-01T01:00:00+05:00")), autordf::DataConvertionFailure);
+    ASSERT_EQ("9999-12-31T23:59:59Z", (toRdf<ptime, RdfTypeEnum::xsd_dateTime>::val(toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val("9999-12-31T23:59:59Z"))));
+}
+
+// Not a real test: prints conversion throughput, to be compared when modifying conversions
+TEST(_04_cvt, dateTimeBenchmark) {
+    using namespace boost::posix_time;
+    const int ITERATIONS = 100000;
+    const std::string literal = "2002-10-10T12:00:00.123456-05:00";
+    const ptime time = toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val(literal);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        ASSERT_EQ(time, (toCpp<ptime, RdfTypeEnum::xsd_dateTime>::val(literal)));
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "xsd:dateTime to ptime: " << elapsed.count() / ITERATIONS << " ns per conversion" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    size_t size = 0;
+    for (int i = 0; i < ITERATIONS; ++i) {
+        size += toRdf<ptime, RdfTypeEnum::xsd_dateTime>::val(time + seconds(i)).size();
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "ptime to xsd:dateTime: " << elapsed.count() / ITERATIONS << " ns per conversion" << std::endl;
+    ASSERT_EQ(ITERATIONS * std::string("2002-10-10T17:00:00.123456Z").size(), size);
+}
@@ -1,3 +1,8 @@
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include "autordf/PropertyValue.h"
 #include "autordf/cvt/RdfTypeEnum.h"
@@ -33,4 +38,120 @@ TEST(_05_PropertyValue, Comparison_rdfLangString) {
     EXPECT_EQ(val1, val2); // no datatype but lang not empty == rdf_langString type
     EXPECT_NE(val1, val3); // different language tag
     EXPECT_NE(val3, val4); // different data type
-}
\ No newline at end of file
+}
+TEST(_05_PropertyValue, DataType) {
+    PropertyValue val1("1", "", cvt::rdfTypeIri(cvt::RdfTypeEnum::xsd_integer));
+    PropertyValue val2("1", "", "http://example.org/myType");
+    PropertyValue val3("1", "", "");
+
+    EXPECT_EQ(cvt::rdfTypeIri(cvt::RdfTypeEnum::xsd_integer), val1.dataTypeIri());
+    EXPECT_EQ(cvt::RdfTypeEnum::xsd_integer, val1.rdfType());
+    EXPECT_EQ("http://example.org/myType", val2.dataTypeIri());
+    EXPECT_FALSE(val2.rdfType());
+    EXPECT_EQ("", val3.dataTypeIri());
+    EXPECT_FALSE(val3.rdfType());
+
+    val3.setDataTypeIri("http://example.org/myType");
+    EXPECT_EQ(val2, val3);
+    val3.setDataTypeIri("");
+    EXPECT_EQ("", val3.dataTypeIri());
+
+    PropertyValue val4("1", "fr", "");
+    EXPECT_EQ("fr", val4.lang());
+    val4.setLang("");
+    EXPECT_EQ("", val4.lang());
+    EXPECT_EQ(val3, val4);
+
+    // Unknown data types and langs belong to the values, and outlive the value they were copied from
+    std::optional<PropertyValue> original(PropertyValue("1", "de", "http://example.org/otherType"));
+    PropertyValue copy(*original);
+    original.reset();
+    EXPECT_EQ("http://example.org/otherType", copy.dataTypeIri());
+    EXPECT_EQ("de", copy.lang());
+    PropertyValue moved(std::move(copy));
+    EXPECT_EQ(PropertyValue("1", "de", "http://example.org/otherType"), moved);
+}
+
+TEST(_05_PropertyValue, DecodedValue) {
+    PropertyValue val("12", "", cvt::rdfTypeIri(cvt::RdfTypeEnum::xsd_integer));
+    EXPECT_EQ(12, (val.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    EXPECT_EQ(12, (val.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    EXPECT_EQ(12.0, (val.get<cvt::RdfTypeEnum::xsd_double, double>()));
+    EXPECT_EQ(12, (val.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+
+    val.set<cvt::RdfTypeEnum::xsd_integer>(13LL);
+    EXPECT_EQ(13, (val.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    val.assign("14");
+    EXPECT_EQ(14, (val.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    val += "0";
+    EXPECT_EQ(140, (val.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    val = PropertyValue("15");
+    EXPECT_EQ(15, (val.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    val.clear();
+    EXPECT_THROW((val.get<cvt::RdfTypeEnum::xsd_integer, long long>()), DataConvertionFailure);
+
+    // Range checks of the requested type are still applied
+    PropertyValue big("300");
+    EXPECT_EQ(300, (big.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    EXPECT_THROW((big.get<cvt::RdfTypeEnum::xsd_byte, char>()), DataConvertionFailure);
+    EXPECT_THROW((big.get<cvt::RdfTypeEnum::xsd_negativeInteger, long long>()), DataConvertionFailure);
+
+    // Copies share the decoded value, but not its invalidation
+    PropertyValue copy(big);
+    copy.assign("301");
+    EXPECT_EQ(300, (big.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+    EXPECT_EQ(301, (copy.get<cvt::RdfTypeEnum::xsd_integer, long long>()));
+}
+
+TEST(_05_PropertyValue, DecodedValueDroppedByMutators) {
+    auto integer = [](const PropertyValue& val) {
+        return val.get<cvt::RdfTypeEnum::xsd_integer, long long>();
+    };
+    PropertyValue val("12");
+    EXPECT_EQ(12, integer(val));
+    val.append("3");
+    EXPECT_EQ(123, integer(val));
+    val[0] = '4';
+    EXPECT_EQ(423, integer(val));
+    val.at(1) = '5';
+    EXPECT_EQ(453, integer(val));
+    val.resize(2);
+    EXPECT_EQ(45, integer(val));
+    val.erase(0, 1);
+    EXPECT_EQ(5, integer(val));
+    val.insert(0, "6");
+    EXPECT_EQ(65, integer(val));
+    val.replace(0, 1, "7");
+    EXPECT_EQ(75, integer(val));
+    val.push_back('1');
+    EXPECT_EQ(751, integer(val));
+    val.pop_back();
+    EXPECT_EQ(75, integer(val));
+    val.back() = '9';
+    EXPECT_EQ(79, integer(val));
+    *val.begin() = '8';
+    EXPECT_EQ(89, integer(val));
+    std::string other("10");
+    val.swap(other);
+    EXPECT_EQ(10, integer(val));
+}
+
+TEST(_05_PropertyValue, DecodedValueConcurrentReads) {
+    PropertyValue val("42", "", cvt::rdfTypeIri(cvt::RdfTypeEnum::xsd_integer));
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&val, &failures]() {
+            for (int j = 0; j < 10000; ++j) {
+                if (val.get<cvt::RdfTypeEnum::xsd_integer, long long>() != 42 ||
+                    val.get<cvt::RdfTypeEnum::xsd_double, double>() != 42.0) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, failures);
+}
@@ -1,4 +1,9 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
 #include <locale>
+#include <new>
 
 #include <autordf/Factory.h>
 #include <autordf/Storage.h>
@@ -6,12 +11,50 @@
 
 using namespace autordf;
 
+namespace {
+// Heap allocations count, to keep track of getters allocations
+std::atomic<unsigned long> allocations(0);
+}
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if ( void *p = std::malloc(size ? size : 1) ) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+/**
+ * Runs getter on each object, printing time and heap allocations per call
+ */
+template<typename Getter> void measure(const std::string& name, const std::vector<Object>& objects, Getter getter) {
+    size_t count = 0;
+    unsigned long allocationsBefore = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for ( const Object& o : objects ) {
+        count += getter(o);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << name << ": " << elapsed.count() / objects.size() << " ns, "
+              << (allocations - allocationsBefore) / objects.size() << " allocations per call ("
+              << count << " values)" << std::endl;
+}
+
 int main(int, char **) {
     Factory f;
     Object::setFactory(&f);
 
     static unsigned int OBJECTS_COUNT = 3000;
 
+    std::vector<Object> objects;
     for ( unsigned int i = 0; i < OBJECTS_COUNT; i++) {
         std::stringstream ss;
         ss << "http://myobject" << i;
@@ -23,8 +66,41 @@ int main(int, char **) {
             v << "http://value" << j;
             o.setPropertyValue(p.str(), v.str());
         }
+        for ( unsigned int j = 0; j < 10; ++j ) {
+            o.addPropertyValue("http://propertyList", PropertyValue().set<cvt::RdfTypeEnum::xsd_integer>(static_cast<long long>(j)), false);
+            o.addObject("http://objectList", Object("http://value" + std::to_string(j)), false);
+        }
+        objects.push_back(o);
     }
 
+    measure("getPropertyValue", objects, [](const Object& o) {
+        return o.getPropertyValue("http://property0").size() ? 1 : 0;
+    });
+    measure("getPropertyValueList", objects, [](const Object& o) {
+        return o.getPropertyValueList("http://propertyList", false).size();
+    });
+    measure("getObjectList", objects, [](const Object& o) {
+        return o.getObjectList("http://objectList", false).size();
+    });
+
+    static const Predicate property0("http://property0");
+    static const Predicate propertyList("http://propertyList");
+    static const Predicate objectList("http://objectList");
+    measure("getPropertyValue(Predicate)", objects, [](const Object& o) {
+        return o.getPropertyValue(property0).size() ? 1 : 0;
+    });
+    measure("getPropertyValueList(Predicate)", objects, [](const Object& o) {
+        return o.getPropertyValueList(propertyList, false).size();
+    });
+    measure("getObjectList(Predicate)", objects, [](const Object& o) {
+        return o.getObjectList(objectList, false).size();
+    });
+    measure("snapshot", objects, [](const Object& o) {
+        PropertySnapshot snapshot = o.snapshot();
+        return snapshot.values(property0, false).size() + snapshot.values(propertyList, false).size() +
+               snapshot.values(objectList, false).size();
+    });
+
     for ( unsigned int i = 0; i < OBJECTS_COUNT; i++) {
         std::stringstream ss;
         ss << "http://myobject" << i;